@@ -22,6 +22,7 @@
 
 #include "gui/EventRecorder.h"
 
+#include "common/profiler.h"
 #include "common/util.h"
 #include "common/textconsole.h"
 
@@ -265,6 +266,7 @@ void MixerImpl::playStream(
 }
 
 int MixerImpl::mixCallback(byte *samples, uint len) {
+	PROFILE_ZONE("MixerImpl::mixCallback");
 	assert(samples);
 
 	Common::StackLock lock(_mutex);
@@ -142,6 +142,13 @@ GL_FUNC_2_DEF(GLenum, glCheckFramebufferStatus, glCheckFramebufferStatusEXT, (GL
 GL_FUNC_2_DEF(void, glActiveTexture, glActiveTextureARB, (GLenum texture));
 #endif
 
+GL_EXT_FUNC_DEF(void, glGenBuffers, (GLsizei n, GLuint *buffers));
+GL_EXT_FUNC_DEF(void, glDeleteBuffers, (GLsizei n, const GLuint *buffers));
+GL_EXT_FUNC_DEF(void, glBindBuffer, (GLenum target, GLuint buffer));
+GL_EXT_FUNC_DEF(void, glBufferData, (GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage));
+GL_EXT_FUNC_DEF(GLvoid *, glMapBuffer, (GLenum target, GLenum access));
+GL_EXT_FUNC_DEF(GLboolean, glUnmapBuffer, (GLenum target));
+
 #ifdef DEFINED_GL_EXT_FUNC_DEF
 #undef DEFINED_GL_EXT_FUNC_DEF
 #undef GL_EXT_FUNC_DEF
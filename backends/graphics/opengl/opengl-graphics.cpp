@@ -29,6 +29,7 @@
 #include "backends/graphics/opengl/shader.h"
 
 #include "common/array.h"
+#include "common/config-manager.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #include "common/algorithm.h"
@@ -58,7 +59,7 @@ namespace OpenGL {
 
 OpenGLGraphicsManager::OpenGLGraphicsManager()
     : _currentState(), _oldState(), _transactionMode(kTransactionNone), _screenChangeID(1 << (sizeof(int) * 8 - 2)),
-      _pipeline(nullptr), _stretchMode(STRETCH_FIT),
+      _pipeline(nullptr), _gpuPaletteLookUp(true), _stretchMode(STRETCH_FIT),
       _defaultFormat(), _defaultFormatAlpha(),
       _gameScreen(nullptr), _overlay(nullptr),
       _cursor(nullptr),
@@ -72,6 +73,10 @@ OpenGLGraphicsManager::OpenGLGraphicsManager()
     {
 	memset(_gamePalette, 0, sizeof(_gamePalette));
 	g_context.reset();
+
+	if (ConfMan.hasKey("gpu_palette_lookup")) {
+		_gpuPaletteLookUp = ConfMan.getBool("gpu_palette_lookup");
+	}
 }
 
 OpenGLGraphicsManager::~OpenGLGraphicsManager() {
@@ -895,8 +900,11 @@ void OpenGLGraphicsManager::setPalette(const byte *colors, uint start, uint num)
 	memcpy(_gamePalette + start * 3, colors, num * 3);
 	_gameScreen->setPalette(start, num, colors);
 
-	// We might need to update the cursor palette here.
-	updateCursorPalette();
+	// We might need to update the cursor palette here. This is not required
+	// when the cursor uses its own palette.
+	if (!_cursorPaletteEnabled) {
+		updateCursorPalette();
+	}
 }
 
 void OpenGLGraphicsManager::grabPalette(byte *colors, uint start, uint num) const {
@@ -1018,7 +1026,12 @@ void OpenGLGraphicsManager::notifyContextCreate(const Graphics::PixelFormat &def
 	_defaultFormatAlpha = defaultFormatAlpha;
 
 	if (_gameScreen) {
-		_gameScreen->recreate();
+		if (_gameScreen->hasPalette()) {
+			recreateCLUT8Surface(_gameScreen, false);
+			_gameScreen->setPalette(0, 256, _gamePalette);
+		} else {
+			_gameScreen->recreate();
+		}
 	}
 
 	if (_overlay) {
@@ -1026,7 +1039,12 @@ void OpenGLGraphicsManager::notifyContextCreate(const Graphics::PixelFormat &def
 	}
 
 	if (_cursor) {
-		_cursor->recreate();
+		if (_cursor->hasPalette()) {
+			recreateCLUT8Surface(_cursor, true);
+			updateCursorPalette();
+		} else {
+			_cursor->recreate();
+		}
 	}
 
 #ifdef USE_OSD
@@ -1082,7 +1100,7 @@ Surface *OpenGLGraphicsManager::createSurface(const Graphics::PixelFormat &forma
 	GLenum glIntFormat, glFormat, glType;
 	if (format.bytesPerPixel == 1) {
 #if !USE_FORCED_GLES
-		if (TextureCLUT8GPU::isSupportedByContext()) {
+		if (_gpuPaletteLookUp && TextureCLUT8GPU::isSupportedByContext()) {
 			return new TextureCLUT8GPU();
 		}
 #endif
@@ -1118,6 +1136,19 @@ Surface *OpenGLGraphicsManager::createSurface(const Graphics::PixelFormat &forma
 	}
 }
 
+void OpenGLGraphicsManager::recreateCLUT8Surface(Surface *&surface, bool wantAlpha) {
+	Surface *newSurface = createSurface(Graphics::PixelFormat::createFormatCLUT8(), wantAlpha);
+	assert(newSurface);
+
+	const Graphics::Surface *src = surface->getSurface();
+	newSurface->allocate(src->w, src->h);
+	newSurface->copyRectToTexture(0, 0, src->w, src->h, src->getPixels(), src->pitch);
+	newSurface->enableLinearFiltering(_currentState.filtering);
+
+	delete surface;
+	surface = newSurface;
+}
+
 bool OpenGLGraphicsManager::getGLPixelFormat(const Graphics::PixelFormat &pixelFormat, GLenum &glIntFormat, GLenum &glFormat, GLenum &glType) const {
 #ifdef SCUMM_LITTLE_ENDIAN
 	if (pixelFormat == Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24)) { // ABGR8888
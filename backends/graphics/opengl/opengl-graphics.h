@@ -166,6 +166,17 @@ protected:
 	 */
 	Surface *createSurface(const Graphics::PixelFormat &format, bool wantAlpha = false);
 
+	/**
+	 * Replace a CLUT8 surface by a newly created one which matches the
+	 * capabilities of the current context. The pixel data is kept, the
+	 * palette needs to be set up by the caller.
+	 *
+	 * The kind of surface used for CLUT8 data depends on whether the context
+	 * allows palette look ups on the GPU. Thus, after a context change the
+	 * existing surface might be unusable.
+	 */
+	void recreateCLUT8Surface(Surface *&surface, bool wantAlpha);
+
 	//
 	// Transaction support
 	//
@@ -286,6 +297,14 @@ private:
 	 */
 	Pipeline *_pipeline;
 
+	/**
+	 * Whether CLUT8 surfaces should do the palette look up on the GPU when
+	 * the context supports it. Controlled by the "gpu_palette_lookup" config
+	 * key, which allows to compare both paths, for example with Mesa's
+	 * software rasterizer.
+	 */
+	bool _gpuPaletteLookUp;
+
 protected:
 	/**
 	 * Query the address of an OpenGL function by name.
@@ -76,6 +76,23 @@
 	#include "backends/graphics/opengl/opengl-defs.h"
 #endif
 
+#ifdef USE_BUILTIN_OPENGL
+	// The system headers might lack constants for functionality we only use
+	// when the context reports it as available.
+	#ifndef GL_UNPACK_ROW_LENGTH
+		#define GL_UNPACK_ROW_LENGTH   0x0CF2
+	#endif
+	#ifndef GL_PIXEL_UNPACK_BUFFER
+		#define GL_PIXEL_UNPACK_BUFFER 0x88EC
+	#endif
+	#ifndef GL_STREAM_DRAW
+		#define GL_STREAM_DRAW         0x88E0
+	#endif
+	#ifndef GL_WRITE_ONLY
+		#define GL_WRITE_ONLY          0x88B9
+	#endif
+#endif
+
 #ifdef SDL_BACKEND
 	// Win32 needs OpenGL functions declared with APIENTRY.
 	// However, SDL does not define APIENTRY in it's SDL.h file on non-Windows
@@ -129,6 +146,15 @@ struct Context {
 	/** Whether FBO support is available or not. */
 	bool framebufferObjectSupported;
 
+	/**
+	 * Whether GL_UNPACK_ROW_LENGTH is available or not. This allows to
+	 * upload sub rectangles of a texture without uploading full rows.
+	 */
+	bool unpackSubImageSupported;
+
+	/** Whether PBO support for streaming texture uploads is available or not. */
+	bool pixelBufferObjectSupported;
+
 #define GL_FUNC_DEF(ret, name, param) ret (GL_CALL_CONV *name)param
 #include "backends/graphics/opengl/opengl-func.h"
 #undef GL_FUNC_DEF
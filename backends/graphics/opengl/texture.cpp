@@ -37,12 +37,15 @@ GLTexture::GLTexture(GLenum glIntFormat, GLenum glFormat, GLenum glType)
     : _glIntFormat(glIntFormat), _glFormat(glFormat), _glType(glType),
       _width(0), _height(0), _logicalWidth(0), _logicalHeight(0),
       _texCoords(), _glFilter(GL_NEAREST),
-      _glTexture(0) {
+      _glTexture(0), _glPixelBuffer(0) {
 	create();
 }
 
 GLTexture::~GLTexture() {
 	GL_CALL_SAFE(glDeleteTextures, (1, &_glTexture));
+	if (_glPixelBuffer) {
+		GL_CALL_SAFE(glDeleteBuffers, (1, &_glPixelBuffer));
+	}
 }
 
 void GLTexture::enableLinearFiltering(bool enable) {
@@ -61,6 +64,11 @@ void GLTexture::enableLinearFiltering(bool enable) {
 void GLTexture::destroy() {
 	GL_CALL(glDeleteTextures(1, &_glTexture));
 	_glTexture = 0;
+
+	if (_glPixelBuffer) {
+		GL_CALL_SAFE(glDeleteBuffers, (1, &_glPixelBuffer));
+		_glPixelBuffer = 0;
+	}
 }
 
 void GLTexture::create() {
@@ -135,26 +143,63 @@ void GLTexture::updateArea(const Common::Rect &area, const Graphics::Surface &sr
 	// Set the texture on the active texture unit.
 	bind();
 
+	if (g_context.pixelBufferObjectSupported && updateAreaPBO(area, src)) {
+		return;
+	}
+
 	// Update the actual texture.
-	// Although we have the area of the texture buffer we want to update we
-	// cannot take advantage of the left/right boundries here because it is
-	// not possible to specify a pitch to glTexSubImage2D. To be precise, with
-	// plain OpenGL we could set GL_UNPACK_ROW_LENGTH to achieve this. However,
-	// OpenGL ES 1.0 does not support GL_UNPACK_ROW_LENGTH. Thus, we are left
-	// with the following options:
-	//
-	// 1) (As we do right now) Simply always update the whole texture lines of
-	//    rect changed. This is simplest to implement. In case performance is
-	//    really an issue we can think of switching to another method.
-	//
-	// 2) Copy the dirty rect to a temporary buffer and upload that by using
-	//    glTexSubImage2D. This is what the Android backend does. It is more
-	//    complicated though.
-	//
-	// 3) Use glTexSubImage2D per line changed. This is what the old OpenGL
-	//    graphics manager did but it is much slower! Thus, we do not use it.
-	GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, area.top, src.w, area.height(),
-	                       _glFormat, _glType, src.getBasePtr(0, area.top)));
+	// When GL_UNPACK_ROW_LENGTH is available we can specify the pitch of the
+	// source data and upload exactly the area changed. OpenGL ES 1.0 and
+	// OpenGL ES 2.0 without GL_EXT_unpack_subimage lack this. In that case
+	// we update the whole texture lines of the rect changed, which is still
+	// much faster than using glTexSubImage2D per line changed.
+	const uint bytesPerPixel = src.format.bytesPerPixel;
+	if (g_context.unpackSubImageSupported && (src.pitch % bytesPerPixel) == 0) {
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, src.pitch / bytesPerPixel));
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(),
+		                        _glFormat, _glType, src.getBasePtr(area.left, area.top)));
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+	} else {
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, area.top, src.w, area.height(),
+		                        _glFormat, _glType, src.getBasePtr(0, area.top)));
+	}
+}
+
+bool GLTexture::updateAreaPBO(const Common::Rect &area, const Graphics::Surface &src) {
+	const uint rowSize = area.width() * src.format.bytesPerPixel;
+	const GLsizeiptr size = rowSize * area.height();
+
+	if (!_glPixelBuffer) {
+		GL_CALL(glGenBuffers(1, &_glPixelBuffer));
+	}
+
+	GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _glPixelBuffer));
+
+	// Orphan the old buffer storage. This way we do not have to wait for a
+	// pending upload from the buffer to finish before we can write to it.
+	GL_CALL(glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW));
+
+	GLvoid *mapped;
+	GL_ASSIGN(mapped, glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY));
+	if (mapped) {
+		// Store the area tightly packed, thus we need no special unpack
+		// state.
+		byte *dst = (byte *)mapped;
+		const byte *srcPtr = (const byte *)src.getBasePtr(area.left, area.top);
+		for (int y = area.height(); y > 0; --y) {
+			memcpy(dst, srcPtr, rowSize);
+			dst += rowSize;
+			srcPtr += src.pitch;
+		}
+		GL_CALL(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+
+		// With a bound unpack buffer the data pointer is an offset into it.
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(),
+		                        _glFormat, _glType, NULL));
+	}
+
+	GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+	return mapped != NULL;
 }
 
 //
@@ -162,7 +207,7 @@ void GLTexture::updateArea(const Common::Rect &area, const Graphics::Surface &sr
 //
 
 Surface::Surface()
-    : _allDirty(false), _dirtyArea() {
+    : _allDirty(false), _dirtyAreas(), _numDirtyAreas(0) {
 }
 
 void Surface::copyRectToTexture(uint x, uint y, uint w, uint h, const void *srcPtr, uint srcPitch) {
@@ -170,15 +215,7 @@ void Surface::copyRectToTexture(uint x, uint y, uint w, uint h, const void *srcP
 	assert(x + w <= dstSurf->w);
 	assert(y + h <= dstSurf->h);
 
-	// *sigh* Common::Rect::extend behaves unexpected whenever one of the two
-	// parameters is an empty rect. Thus, we check whether the current dirty
-	// area is valid. In case it is not we simply use the parameters as new
-	// dirty area. Otherwise, we simply call extend.
-	if (_dirtyArea.isEmpty()) {
-		_dirtyArea = Common::Rect(x, y, x + w, y + h);
-	} else {
-		_dirtyArea.extend(Common::Rect(x, y, x + w, y + h));
-	}
+	addDirtyArea(Common::Rect(x, y, x + w, y + h));
 
 	const byte *src = (const byte *)srcPtr;
 	byte *dst = (byte *)dstSurf->getBasePtr(x, y);
@@ -203,12 +240,86 @@ void Surface::fill(uint32 color) {
 	flagDirty();
 }
 
-Common::Rect Surface::getDirtyArea() const {
+namespace {
+inline uint rectArea(const Common::Rect &r) {
+	return r.width() * r.height();
+}
+
+inline Common::Rect rectUnion(const Common::Rect &a, const Common::Rect &b) {
+	Common::Rect result(a);
+	result.extend(b);
+	return result;
+}
+
+/**
+ * Whether uploading the union of two areas is preferable over uploading them
+ * separately. Every upload has a fixed overhead, thus we accept a bit of
+ * wasted space in exchange for fewer uploads.
+ */
+inline bool shouldMergeAreas(const Common::Rect &a, const Common::Rect &b) {
+	if (a.intersects(b)) {
+		return true;
+	}
+
+	const uint separateArea = rectArea(a) + rectArea(b);
+	return rectArea(rectUnion(a, b)) <= separateArea + separateArea / 4;
+}
+} // End of anonymous namespace
+
+void Surface::addDirtyArea(const Common::Rect &area) {
+	// *sigh* Common::Rect::extend behaves unexpected whenever one of the two
+	// parameters is an empty rect. Thus, we never store empty areas.
+	if (area.isEmpty() || _allDirty) {
+		return;
+	}
+
+	Common::Rect newArea(area);
+
+	// Merge the new area with all areas close to it. Merging can make the
+	// area big enough to touch other areas, thus we start over after every
+	// merge.
+	for (uint i = 0; i < _numDirtyAreas;) {
+		if (_dirtyAreas[i].contains(newArea)) {
+			return;
+		}
+
+		if (shouldMergeAreas(_dirtyAreas[i], newArea)) {
+			newArea.extend(_dirtyAreas[i]);
+			_dirtyAreas[i] = _dirtyAreas[--_numDirtyAreas];
+			i = 0;
+		} else {
+			++i;
+		}
+	}
+
+	if (_numDirtyAreas < kMaxDirtyAreas) {
+		_dirtyAreas[_numDirtyAreas++] = newArea;
+		return;
+	}
+
+	// The list is full. Merge into the area which grows the least.
+	uint best = 0;
+	uint bestGrowth = 0xFFFFFFFF;
+	for (uint i = 0; i < _numDirtyAreas; ++i) {
+		const uint growth = rectArea(rectUnion(_dirtyAreas[i], newArea)) - rectArea(_dirtyAreas[i]);
+		if (growth < bestGrowth) {
+			best = i;
+			bestGrowth = growth;
+		}
+	}
+	_dirtyAreas[best].extend(newArea);
+}
+
+uint Surface::getDirtyAreas(Common::Rect *areas) const {
 	if (_allDirty) {
-		return Common::Rect(getWidth(), getHeight());
-	} else {
-		return _dirtyArea;
+		areas[0] = Common::Rect(getWidth(), getHeight());
+		return 1;
+	}
+
+	for (uint i = 0; i < _numDirtyAreas; ++i) {
+		areas[i] = _dirtyAreas[i];
 	}
+	return _numDirtyAreas;
 }
 
 //
@@ -268,8 +379,18 @@ void Texture::updateGLTexture() {
 		return;
 	}
 
-	Common::Rect dirtyArea = getDirtyArea();
+	Common::Rect dirtyAreas[kMaxDirtyAreas];
+	const uint numDirtyAreas = getDirtyAreas(dirtyAreas);
+
+	for (uint i = 0; i < numDirtyAreas; ++i) {
+		updateArea(dirtyAreas[i]);
+	}
+
+	// We should have handled everything, thus not dirty anymore.
+	clearDirty();
+}
 
+void Texture::updateArea(Common::Rect dirtyArea) {
 	// In case we use linear filtering we might need to duplicate the last
 	// pixel row/column to avoid glitches with filtering.
 	if (_glTexture.isLinearFilteringEnabled()) {
@@ -300,9 +421,6 @@ void Texture::updateGLTexture() {
 	}
 
 	_glTexture.updateArea(dirtyArea, _textureData);
-
-	// We should have handled everything, thus not dirty anymore.
-	clearDirty();
 }
 
 TextureCLUT8::TextureCLUT8(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format)
@@ -399,20 +517,26 @@ void TextureCLUT8::updateGLTexture() {
 	// Do the palette look up
 	Graphics::Surface *outSurf = Texture::getSurface();
 
-	Common::Rect dirtyArea = getDirtyArea();
-
-	if (outSurf->format.bytesPerPixel == 2) {
-		doPaletteLookUp<uint16>((uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        dirtyArea.width(), dirtyArea.height(),
-		                        outSurf->pitch, _clut8Data.pitch, (const uint16 *)_palette);
-	} else if (outSurf->format.bytesPerPixel == 4) {
-		doPaletteLookUp<uint32>((uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        dirtyArea.width(), dirtyArea.height(),
-		                        outSurf->pitch, _clut8Data.pitch, (const uint32 *)_palette);
-	} else {
-		warning("TextureCLUT8::updateGLTexture: Unsupported pixel depth: %d", outSurf->format.bytesPerPixel);
+	Common::Rect dirtyAreas[kMaxDirtyAreas];
+	const uint numDirtyAreas = getDirtyAreas(dirtyAreas);
+
+	for (uint i = 0; i < numDirtyAreas; ++i) {
+		const Common::Rect &dirtyArea = dirtyAreas[i];
+
+		if (outSurf->format.bytesPerPixel == 2) {
+			doPaletteLookUp<uint16>((uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        dirtyArea.width(), dirtyArea.height(),
+			                        outSurf->pitch, _clut8Data.pitch, (const uint16 *)_palette);
+		} else if (outSurf->format.bytesPerPixel == 4) {
+			doPaletteLookUp<uint32>((uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        dirtyArea.width(), dirtyArea.height(),
+			                        outSurf->pitch, _clut8Data.pitch, (const uint32 *)_palette);
+		} else {
+			warning("TextureCLUT8::updateGLTexture: Unsupported pixel depth: %d", outSurf->format.bytesPerPixel);
+			break;
+		}
 	}
 
 	// Do generic handling of updating the texture.
@@ -458,25 +582,30 @@ void TextureRGB555::updateGLTexture() {
 	// Convert color space.
 	Graphics::Surface *outSurf = Texture::getSurface();
 
-	const Common::Rect dirtyArea = getDirtyArea();
+	Common::Rect dirtyAreas[kMaxDirtyAreas];
+	const uint numDirtyAreas = getDirtyAreas(dirtyAreas);
 
-	uint16 *dst = (uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top);
-	const uint dstAdd = outSurf->pitch - 2 * dirtyArea.width();
+	for (uint i = 0; i < numDirtyAreas; ++i) {
+		const Common::Rect &dirtyArea = dirtyAreas[i];
 
-	const uint16 *src = (const uint16 *)_rgbData.getBasePtr(dirtyArea.left, dirtyArea.top);
-	const uint srcAdd = _rgbData.pitch - 2 * dirtyArea.width();
+		uint16 *dst = (uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top);
+		const uint dstAdd = outSurf->pitch - 2 * dirtyArea.width();
 
-	for (int height = dirtyArea.height(); height > 0; --height) {
-		for (int width = dirtyArea.width(); width > 0; --width) {
-			const uint16 color = *src++;
+		const uint16 *src = (const uint16 *)_rgbData.getBasePtr(dirtyArea.left, dirtyArea.top);
+		const uint srcAdd = _rgbData.pitch - 2 * dirtyArea.width();
 
-			*dst++ =   ((color & 0x7C00) << 1)                             // R
-			         | (((color & 0x03E0) << 1) | ((color & 0x0200) >> 4)) // G
-			         | (color & 0x001F);                                   // B
-		}
+		for (int height = dirtyArea.height(); height > 0; --height) {
+			for (int width = dirtyArea.width(); width > 0; --width) {
+				const uint16 color = *src++;
+
+				*dst++ =   ((color & 0x7C00) << 1)                             // R
+				         | (((color & 0x03E0) << 1) | ((color & 0x0200) >> 4)) // G
+				         | (color & 0x001F);                                   // B
+			}
 
-		src = (const uint16 *)((const byte *)src + srcAdd);
-		dst = (uint16 *)((byte *)dst + dstAdd);
+			src = (const uint16 *)((const byte *)src + srcAdd);
+			dst = (uint16 *)((byte *)dst + dstAdd);
+		}
 	}
 
 	// Do generic handling of updating the texture.
@@ -508,23 +637,28 @@ void TextureRGBA8888Swap::updateGLTexture() {
 	// Convert color space.
 	Graphics::Surface *outSurf = Texture::getSurface();
 
-	const Common::Rect dirtyArea = getDirtyArea();
+	Common::Rect dirtyAreas[kMaxDirtyAreas];
+	const uint numDirtyAreas = getDirtyAreas(dirtyAreas);
 
-	uint32 *dst = (uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top);
-	const uint dstAdd = outSurf->pitch - 4 * dirtyArea.width();
+	for (uint i = 0; i < numDirtyAreas; ++i) {
+		const Common::Rect &dirtyArea = dirtyAreas[i];
 
-	const uint32 *src = (const uint32 *)_rgbData.getBasePtr(dirtyArea.left, dirtyArea.top);
-	const uint srcAdd = _rgbData.pitch - 4 * dirtyArea.width();
+		uint32 *dst = (uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top);
+		const uint dstAdd = outSurf->pitch - 4 * dirtyArea.width();
 
-	for (int height = dirtyArea.height(); height > 0; --height) {
-		for (int width = dirtyArea.width(); width > 0; --width) {
-			const uint32 color = *src++;
+		const uint32 *src = (const uint32 *)_rgbData.getBasePtr(dirtyArea.left, dirtyArea.top);
+		const uint srcAdd = _rgbData.pitch - 4 * dirtyArea.width();
 
-			*dst++ = SWAP_BYTES_32(color);
-		}
+		for (int height = dirtyArea.height(); height > 0; --height) {
+			for (int width = dirtyArea.width(); width > 0; --width) {
+				const uint32 color = *src++;
 
-		src = (const uint32 *)((const byte *)src + srcAdd);
-		dst = (uint32 *)((byte *)dst + dstAdd);
+				*dst++ = SWAP_BYTES_32(color);
+			}
+
+			src = (const uint32 *)((const byte *)src + srcAdd);
+			dst = (uint32 *)((byte *)dst + dstAdd);
+		}
 	}
 
 	// Do generic handling of updating the texture.
@@ -638,15 +772,23 @@ void TextureCLUT8GPU::setColorKey(uint colorKey) {
 void TextureCLUT8GPU::setPalette(uint start, uint colors, const byte *palData) {
 	byte *dst = _palette + start * 4;
 
+	// Only flag the palette dirty in case any color actually changed. This
+	// avoids a palette upload and color look up for redundant updates.
+	bool changed = false;
 	while (colors-- > 0) {
-		memcpy(dst, palData, 3);
-		dst[3] = 0xFF;
+		if (dst[0] != palData[0] || dst[1] != palData[1] || dst[2] != palData[2] || dst[3] != 0xFF) {
+			memcpy(dst, palData, 3);
+			dst[3] = 0xFF;
+			changed = true;
+		}
 
 		dst += 4;
 		palData += 3;
 	}
 
-	_paletteDirty = true;
+	if (changed) {
+		_paletteDirty = true;
+	}
 }
 
 const GLTexture &TextureCLUT8GPU::getGLTexture() const {
@@ -658,7 +800,12 @@ void TextureCLUT8GPU::updateGLTexture() {
 
 	// Update CLUT8 texture if necessary.
 	if (Surface::isDirty()) {
-		_clut8Texture.updateArea(getDirtyArea(), _clut8Data);
+		Common::Rect dirtyAreas[kMaxDirtyAreas];
+		const uint numDirtyAreas = getDirtyAreas(dirtyAreas);
+
+		for (uint i = 0; i < numDirtyAreas; ++i) {
+			_clut8Texture.updateArea(dirtyAreas[i], _clut8Data);
+		}
 		clearDirty();
 	}
 
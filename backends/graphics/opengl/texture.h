@@ -95,7 +95,9 @@ public:
 	 * @param area     The area to update.
 	 * @param src      Surface for the whole texture containing the pixel data
 	 *                 to upload. Only the area described by area will be
-	 *                 uploaded.
+	 *                 uploaded. When the context does not support
+	 *                 GL_UNPACK_ROW_LENGTH the full rows covered by area
+	 *                 are uploaded.
 	 */
 	void updateArea(const Common::Rect &area, const Graphics::Surface &src);
 
@@ -132,6 +134,13 @@ public:
 	 */
 	GLuint getGLTexture() const { return _glTexture; }
 private:
+	/**
+	 * Upload an area through a streaming pixel buffer object.
+	 *
+	 * @return true on success, false when the buffer could not be mapped.
+	 */
+	bool updateAreaPBO(const Common::Rect &area, const Graphics::Surface &src);
+
 	const GLenum _glIntFormat;
 	const GLenum _glFormat;
 	const GLenum _glType;
@@ -143,6 +152,7 @@ private:
 	GLint _glFilter;
 
 	GLuint _glTexture;
+	GLuint _glPixelBuffer;
 };
 
 /**
@@ -201,7 +211,7 @@ public:
 	void fill(uint32 color);
 
 	void flagDirty() { _allDirty = true; }
-	virtual bool isDirty() const { return _allDirty || !_dirtyArea.isEmpty(); }
+	virtual bool isDirty() const { return _allDirty || _numDirtyAreas != 0; }
 
 	virtual uint getWidth() const = 0;
 	virtual uint getHeight() const = 0;
@@ -239,12 +249,34 @@ public:
 	 */
 	virtual const GLTexture &getGLTexture() const = 0;
 protected:
-	void clearDirty() { _allDirty = false; _dirtyArea = Common::Rect(); }
+	enum {
+		/**
+		 * Maximum number of separate dirty areas tracked. Additional areas
+		 * are merged into the existing ones.
+		 */
+		kMaxDirtyAreas = 4
+	};
+
+	void clearDirty() { _allDirty = false; _numDirtyAreas = 0; }
+
+	/**
+	 * Add an area to the dirty list. Areas which overlap or lie close to an
+	 * already dirty area are merged with it.
+	 */
+	void addDirtyArea(const Common::Rect &area);
 
-	Common::Rect getDirtyArea() const;
+	/**
+	 * Query all dirty areas.
+	 *
+	 * @param areas Array with space for kMaxDirtyAreas rects which receives
+	 *              the dirty areas.
+	 * @return The number of dirty areas stored in areas.
+	 */
+	uint getDirtyAreas(Common::Rect *areas) const;
 private:
 	bool _allDirty;
-	Common::Rect _dirtyArea;
+	Common::Rect _dirtyAreas[kMaxDirtyAreas];
+	uint _numDirtyAreas;
 };
 
 /**
@@ -289,6 +321,11 @@ protected:
 	const Graphics::PixelFormat _format;
 
 private:
+	/**
+	 * Upload a single dirty area of the texture data to the GL texture.
+	 */
+	void updateArea(Common::Rect dirtyArea);
+
 	GLTexture _glTexture;
 
 	Graphics::Surface _textureData;
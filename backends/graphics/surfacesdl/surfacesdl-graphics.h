@@ -34,6 +34,8 @@
 
 #include "backends/platform/sdl/sdl-sys.h"
 
+class SdlScalerPool;
+
 #ifndef RELEASE_BUILD
 // Define this to allow for focus rectangle debugging
 #define USE_SDL_DEBUG_FOCUSRECT
@@ -325,6 +327,7 @@ protected:
 #endif
 
 	ScalerProc *_scalerProc;
+	SdlScalerPool *_scalerPool;
 	int _scalerType;
 	int _transactionMode;
 
@@ -0,0 +1,204 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#if defined(SDL_BACKEND)
+
+#include "backends/graphics/surfacesdl/surfacesdl-scalerpool.h"
+#include "common/config-manager.h"
+#include "common/profiler.h"
+#include "common/textconsole.h"
+
+SdlScalerPool::SdlScalerPool(uint numThreads)
+	: _mutex(0), _workCond(0), _doneCond(0), _nextJob(0), _numJobs(0), _pendingJobs(0), _quit(false) {
+
+	if (!numThreads)
+		return;
+
+	_mutex = SDL_CreateMutex();
+	_workCond = SDL_CreateCond();
+	_doneCond = SDL_CreateCond();
+
+	for (uint i = 0; i < numThreads; ++i) {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+		SDL_Thread *thread = SDL_CreateThread(workerThreadEntry, "ScummVM Scaler", this);
+#else
+		SDL_Thread *thread = SDL_CreateThread(workerThreadEntry, this);
+#endif
+		if (!thread) {
+			warning("SdlScalerPool: Could not create worker thread: %s", SDL_GetError());
+			break;
+		}
+		_threads.push_back(thread);
+	}
+}
+
+SdlScalerPool::~SdlScalerPool() {
+	if (!_mutex)
+		return;
+
+	SDL_LockMutex(_mutex);
+	_quit = true;
+	SDL_CondBroadcast(_workCond);
+	SDL_UnlockMutex(_mutex);
+
+	for (uint i = 0; i < _threads.size(); ++i)
+		SDL_WaitThread(_threads[i], NULL);
+
+	SDL_DestroyCond(_doneCond);
+	SDL_DestroyCond(_workCond);
+	SDL_DestroyMutex(_mutex);
+}
+
+uint SdlScalerPool::getDefaultThreadCount() {
+	if (ConfMan.hasKey("scaler_threads"))
+		return MAX(ConfMan.getInt("scaler_threads"), 0);
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	// Leave one core for the engine thread, which runs a band itself.
+	return CLIP(SDL_GetCPUCount() - 1, 0, 7);
+#else
+	return 0;
+#endif
+}
+
+bool SdlScalerPool::isReentrant(ScalerProc *scalerProc) {
+	// Only scalers known to keep no state outside their arguments may run
+	// on several bands at once. Anything not listed here, including the
+	// NASM versions of the HQ scalers which work on global buffers, is
+	// always scaled with a single job.
+	if (scalerProc == Normal1x)
+		return true;
+#ifdef USE_SCALERS
+	if (scalerProc == Normal2x || scalerProc == Normal3x || scalerProc == Normal1o5x ||
+	    scalerProc == _2xSaI || scalerProc == Super2xSaI || scalerProc == SuperEagle ||
+	    scalerProc == AdvMame2x || scalerProc == AdvMame3x ||
+	    scalerProc == TV2x || scalerProc == DotMatrix)
+		return true;
+#if defined(USE_HQ_SCALERS) && !defined(USE_NASM)
+	if (scalerProc == HQ2x || scalerProc == HQ3x)
+		return true;
+#endif
+#endif
+	return false;
+}
+
+void SdlScalerPool::addJob(ScalerProc *scalerProc, const byte *srcPtr, uint32 srcPitch,
+                           byte *dstPtr, uint32 dstPitch, int width, int height, int scaleFactor) {
+	Job job;
+	job.scalerProc = scalerProc;
+	job.srcPitch = srcPitch;
+	job.dstPitch = dstPitch;
+	job.width = width;
+
+	int numBands = 1;
+	if (!_threads.empty() && isReentrant(scalerProc))
+		numBands = MIN<int>(_threads.size() + 1, height / kMinBandHeight);
+
+	if (numBands <= 1) {
+		job.srcPtr = srcPtr;
+		job.dstPtr = dstPtr;
+		job.height = height;
+		_jobs.push_back(job);
+		return;
+	}
+
+	// Round the band height up to a multiple of 4 lines, the last band takes
+	// whatever remains.
+	const int bandHeight = ((height + numBands - 1) / numBands + 3) & ~3;
+	for (int y = 0; y < height; y += bandHeight) {
+		job.srcPtr = srcPtr + y * srcPitch;
+		job.dstPtr = dstPtr + y * scaleFactor * dstPitch;
+		job.height = MIN(bandHeight, height - y);
+		_jobs.push_back(job);
+	}
+}
+
+void SdlScalerPool::run() {
+	if (_jobs.empty())
+		return;
+
+	if (_threads.empty()) {
+		for (uint i = 0; i < _jobs.size(); ++i) {
+			const Job &job = _jobs[i];
+			PROFILE_ZONE("Scaler");
+			job.scalerProc(job.srcPtr, job.srcPitch, job.dstPtr, job.dstPitch, job.width, job.height);
+		}
+		_jobs.clear();
+		return;
+	}
+
+	SDL_LockMutex(_mutex);
+	_nextJob = 0;
+	_numJobs = _pendingJobs = _jobs.size();
+	if (_pendingJobs > 1)
+		SDL_CondBroadcast(_workCond);
+
+	processJobs();
+
+	while (_pendingJobs > 0)
+		SDL_CondWait(_doneCond, _mutex);
+
+	_jobs.clear();
+	_nextJob = _numJobs = 0;
+	SDL_UnlockMutex(_mutex);
+}
+
+void SdlScalerPool::processJobs() {
+	while (_nextJob < _numJobs) {
+		const Job job = _jobs[_nextJob++];
+
+		SDL_UnlockMutex(_mutex);
+		{
+			PROFILE_ZONE("Scaler");
+			job.scalerProc(job.srcPtr, job.srcPitch, job.dstPtr, job.dstPitch, job.width, job.height);
+		}
+		SDL_LockMutex(_mutex);
+
+		if (--_pendingJobs == 0)
+			SDL_CondSignal(_doneCond);
+	}
+}
+
+void SdlScalerPool::workerThread() {
+	SDL_LockMutex(_mutex);
+	while (true) {
+		while (!_quit && _nextJob >= _numJobs)
+			SDL_CondWait(_workCond, _mutex);
+
+		if (_quit)
+			break;
+
+		processJobs();
+	}
+	SDL_UnlockMutex(_mutex);
+}
+
+int SDLCALL SdlScalerPool::workerThreadEntry(void *arg) {
+	SdlScalerPool *pool = (SdlScalerPool *)arg;
+	assert(pool);
+	pool->workerThread();
+	return 0;
+}
+
+#endif
@@ -0,0 +1,121 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef BACKENDS_GRAPHICS_SURFACESDL_SCALERPOOL_H
+#define BACKENDS_GRAPHICS_SURFACESDL_SCALERPOOL_H
+
+#include "backends/platform/sdl/sdl-sys.h"
+#include "graphics/scaler.h"
+#include "common/array.h"
+
+/**
+ * Small pool of worker threads which runs a scaler over horizontal bands of
+ * a dirty rect in parallel.
+ *
+ * All scalers read their neighbouring lines straight from the (bordered)
+ * source surface, so bands do not need any overlapping setup: every band
+ * simply starts with the matching source and destination line pointers.
+ * Band heights are kept a multiple of 4 source lines so that scalers with
+ * position dependent patterns (DotMatrix) produce the same output as a
+ * single call over the whole rect.
+ *
+ * The calling thread participates in the work and run() only returns when
+ * all queued bands are done, so the caller can treat it as a plain blocking
+ * scaler call.
+ */
+class SdlScalerPool {
+public:
+	/**
+	 * Creates a pool with the given number of additional worker threads.
+	 * With zero threads all work is done inline in run().
+	 */
+	explicit SdlScalerPool(uint numThreads);
+	~SdlScalerPool();
+
+	/**
+	 * Returns a sensible worker count for this machine. The "scaler_threads"
+	 * config key overrides the detected value; 0 disables threading.
+	 */
+	static uint getDefaultThreadCount();
+
+	uint getNumThreads() const { return _threads.size(); }
+
+	/**
+	 * Queues a scale operation. Large areas are split into bands if the
+	 * scaler is reentrant, small ones are queued as a single job.
+	 */
+	void addJob(ScalerProc *scalerProc, const byte *srcPtr, uint32 srcPitch,
+	            byte *dstPtr, uint32 dstPitch, int width, int height, int scaleFactor);
+
+	/**
+	 * Executes all queued jobs and waits for their completion.
+	 */
+	void run();
+
+private:
+	enum {
+		/** Minimum number of source lines per band, must be a multiple of 4. */
+		kMinBandHeight = 32
+	};
+
+	struct Job {
+		ScalerProc *scalerProc;
+		const byte *srcPtr;
+		uint32 srcPitch;
+		byte *dstPtr;
+		uint32 dstPitch;
+		int width;
+		int height;
+	};
+
+	Common::Array<Job> _jobs;
+	Common::Array<SDL_Thread *> _threads;
+
+	SDL_mutex *_mutex;
+	SDL_cond *_workCond;
+	SDL_cond *_doneCond;
+
+	/**
+	 * Queue state shared with the workers, protected by _mutex. _jobs itself
+	 * is only filled while _numJobs is zero, so workers never see it change.
+	 */
+	uint _nextJob;
+	uint _numJobs;
+	uint _pendingJobs;
+	bool _quit;
+
+	/**
+	 * Takes jobs from the queue until it is empty. Must be called with
+	 * _mutex locked; the mutex is released while a job executes.
+	 */
+	void processJobs();
+
+	/**
+	 * Returns whether the scaler may be run on several bands concurrently.
+	 */
+	static bool isReentrant(ScalerProc *scalerProc);
+
+	void workerThread();
+	static int SDLCALL workerThreadEntry(void *arg);
+};
+
+#endif
@@ -26,6 +26,7 @@
 #include "backends/mutex/mutex.h"
 #include "gui/EventRecorder.h"
 
+#include "common/profiler.h"
 #include "audio/mixer.h"
 #include "graphics/pixelformat.h"
 
@@ -172,6 +173,8 @@ void ModularBackend::fillScreen(uint32 col) {
 }
 
 void ModularBackend::updateScreen() {
+	PROFILE_ZONE("OSystem::updateScreen");
+
 #ifdef ENABLE_EVENTRECORDER
 	g_eventRec.preDrawOverlayGui();
 #endif
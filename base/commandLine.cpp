@@ -146,10 +146,14 @@ static const char HELP_STRING[] =
 	"                           atari, macintosh)\n"
 #ifdef ENABLE_EVENTRECORDER
 	"  --record-mode=MODE       Specify record mode for event recorder (record, playback,\n"
-	"                           passthrough [default])\n"
+	"                           benchmark, passthrough [default])\n"
 	"  --record-file-name=FILE  Specify record file name\n"
 	"  --disable-display        Disable any gfx output. Used for headless events\n"
 	"                           playback by Event Recorder\n"
+#endif
+#ifdef ENABLE_PROFILE_ZONES
+	"  --profile-trace=FILE     Save profiling zones to FILE (Chrome trace format)\n"
+	"                           when a game exits\n"
 #endif
 	"\n"
 #if defined(ENABLE_SKY) || defined(ENABLE_QUEEN)
@@ -513,6 +517,11 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			END_OPTION
 #endif
 
+#ifdef ENABLE_PROFILE_ZONES
+			DO_LONG_OPTION("profile-trace")
+			END_OPTION
+#endif
+
 			DO_LONG_OPTION("opl-driver")
 			END_OPTION
 
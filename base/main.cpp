@@ -53,6 +53,7 @@
 #include "common/translation.h"
 #include "common/text-to-speech.h"
 #include "common/osd_message_queue.h"
+#include "common/profiler.h"
 
 #include "gui/gui-manager.h"
 #include "gui/error.h"
@@ -552,6 +553,10 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 				g_eventRec.init(g_eventRec.generateRecordFileName(ConfMan.getActiveDomainName()), GUI::EventRecorder::kRecorderRecord);
 			} else if (recordMode == "playback") {
 				g_eventRec.init(recordFileName, GUI::EventRecorder::kRecorderPlayback);
+			} else if (recordMode == "benchmark") {
+				// Headless, unthrottled playback reporting frame timings
+				ConfMan.setBool("disable_display", true, Common::ConfigManager::kTransientDomain);
+				g_eventRec.init(recordFileName, GUI::EventRecorder::kRecorderPlayback, true);
 			} else if ((recordMode == "info") && (!recordFileName.empty())) {
 				Common::PlaybackFile record;
 				record.openRead(recordFileName);
@@ -576,6 +581,11 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 			g_eventRec.deinit();
 #endif
 
+#ifdef ENABLE_PROFILE_ZONES
+			if (ConfMan.hasKey("profile_trace"))
+				Common::saveProfileTrace(ConfMan.get("profile_trace"));
+#endif
+
 #if defined(UNCACHED_PLUGINS) && defined(DYNAMIC_MODULES)
 			// do our best to prevent fragmentation by unloading as soon as we can
 			PluginManager::instance().unloadPluginsExcept(PLUGIN_TYPE_ENGINE, NULL, false);
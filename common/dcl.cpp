@@ -28,6 +28,18 @@
 
 namespace Common {
 
+/**
+ * Entry of a table for decoding the first bits of a Huffman code at once.
+ */
+struct HuffmanLookupEntry {
+	uint16 pos;		///< tree position reached after consuming the bits
+	byte bits;		///< number of bits consumed
+};
+
+enum {
+	kHuffmanLookupBits = 8
+};
+
 class DecompressorDCL {
 public:
 	bool unpack(SeekableReadStream *sourceStream, WriteStream *targetStream, uint32 targetSize, bool targetFixedSize);
@@ -48,6 +60,20 @@ protected:
 	 */
 	uint32 getBitsLSB(int n);
 
+	/**
+	 * Get a number of bits from _src stream like getBitsLSB, without
+	 * consuming them.
+	 * @param n		number of bits to get
+	 * @return n-bits number
+	 */
+	uint32 peekBitsLSB(int n);
+
+	/**
+	 * Consume bits previously returned by peekBitsLSB.
+	 * @param n		number of bits to skip
+	 */
+	void skipBitsLSB(int n);
+
 	/**
 	 * Get one byte from _src stream.
 	 * @return byte
@@ -62,7 +88,7 @@ protected:
 	 */
 	void putByte(byte b);
 
-	int huffman_lookup(const int *tree);
+	int huffman_lookup(const int *tree, const HuffmanLookupEntry *lookup);
 
 	uint32 _dwBits;			///< bits buffer
 	byte _nBits;			///< number of unread bits in _dwBits
@@ -104,6 +130,17 @@ uint32 DecompressorDCL::getBitsLSB(int n) {
 	return ret;
 }
 
+uint32 DecompressorDCL::peekBitsLSB(int n) {
+	if (_nBits < n)
+		fetchBitsLSB();
+	return _dwBits & ~(~0UL << n);
+}
+
+void DecompressorDCL::skipBitsLSB(int n) {
+	_dwBits >>= n;
+	_nBits -= n;
+}
+
 byte DecompressorDCL::getByteLSB() {
 	return getBitsLSB(8);
 }
@@ -316,8 +353,32 @@ static const int ascii_tree[] = {
 	LN(509, 128)      LN(510, 26)
 };
 
-int DecompressorDCL::huffman_lookup(const int *tree) {
-	int pos = 0;
+// Lookup tables for the trees above, built on first use
+static HuffmanLookupEntry s_lengthLookup[1 << kHuffmanLookupBits];
+static HuffmanLookupEntry s_distanceLookup[1 << kHuffmanLookupBits];
+static HuffmanLookupEntry s_asciiLookup[1 << kHuffmanLookupBits];
+static bool s_lookupsBuilt = false;
+
+static void buildHuffmanLookup(const int *tree, HuffmanLookupEntry *lookup) {
+	for (uint code = 0; code < (1 << kHuffmanLookupBits); code++) {
+		int pos = 0;
+		byte bits = 0;
+
+		while (!(tree[pos] & HUFFMAN_LEAF) && bits < kHuffmanLookupBits) {
+			pos = ((code >> bits) & 1) ? tree[pos] & 0xFFF : tree[pos] >> 12;
+			bits++;
+		}
+
+		lookup[code].pos = pos;
+		lookup[code].bits = bits;
+	}
+}
+
+int DecompressorDCL::huffman_lookup(const int *tree, const HuffmanLookupEntry *lookup) {
+	// Decode the first bits of the code at once, then continue bit by bit
+	const HuffmanLookupEntry &entry = lookup[peekBitsLSB(kHuffmanLookupBits)];
+	skipBitsLSB(entry.bits);
+	int pos = entry.pos;
 
 	while (!(tree[pos] & HUFFMAN_LEAF)) {
 		int bit = getBitsLSB(1);
@@ -372,9 +433,16 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 	}
 	dictionaryMask = dictionarySize - 1;
 
+	if (!s_lookupsBuilt) {
+		buildHuffmanLookup(length_tree, s_lengthLookup);
+		buildHuffmanLookup(distance_tree, s_distanceLookup);
+		buildHuffmanLookup(ascii_tree, s_asciiLookup);
+		s_lookupsBuilt = true;
+	}
+
 	while ((!targetFixedSize) || (_bytesWritten < _targetSize)) {
 		if (getBitsLSB(1)) { // (length,distance) pair
-			value = huffman_lookup(length_tree);
+			value = huffman_lookup(length_tree, s_lengthLookup);
 
 			if (value < 8)
 				tokenLength = value + 2;
@@ -386,7 +454,7 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 
 			debug(8, " | ");
 
-			value = huffman_lookup(distance_tree);
+			value = huffman_lookup(distance_tree, s_distanceLookup);
 
 			if (tokenLength == 2)
 				tokenOffset = (value << 2) | getBitsLSB(2);
@@ -435,7 +503,7 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 			debug(9, "\n");
 
 		} else { // Copy byte verbatim
-			value = (mode == DCL_ASCII_MODE) ? huffman_lookup(ascii_tree) : getByteLSB();
+			value = (mode == DCL_ASCII_MODE) ? huffman_lookup(ascii_tree, s_asciiLookup) : getByteLSB();
 			putByte(value);
 
 			// Also remember it inside dictionary
@@ -25,6 +25,7 @@ MODULE_OBJS := \
 	mutex.o \
 	osd_message_queue.o \
 	platform.o \
+	profiler.o \
 	quicktime.o \
 	random.o \
 	rational.o \
@@ -0,0 +1,214 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// The POSIX implementation needs pthreads, the clock needs clock_gettime()
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include "common/profiler.h"
+#include "common/system.h"
+
+#ifdef HAVE_CLOCK_GETTIME
+#include <time.h>
+#endif
+
+namespace Common {
+
+static uint64 getClockMicros() {
+#ifdef HAVE_CLOCK_GETTIME
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+	return (uint64)g_system->getMillis(true) * 1000;
+#endif
+}
+
+uint32 getProfileMicros() {
+	static uint64 base = 0;
+	uint64 now = getClockMicros();
+	if (!base)
+		base = now;
+	return now > base ? (uint32)(now - base) : 0;
+}
+
+} // End of namespace Common
+
+#ifdef ENABLE_PROFILE_ZONES
+
+#include "common/file.h"
+#include "common/str.h"
+#include "common/textconsole.h"
+
+#ifdef POSIX
+#include <pthread.h>
+#endif
+
+namespace Common {
+
+enum {
+	kMaxProfileThreads = 32,
+	// Entries next to the write position are skipped when exporting, as a
+	// running thread may be overwriting them
+	kProfileExportMargin = 64
+};
+
+struct ProfileEvent {
+	const char *name;
+	uint32 start;
+	uint32 end;
+};
+
+struct ProfileBuffer {
+	ProfileEvent events[kProfileBufferSize];
+	/** Number of zones written so far, the next one goes to count % kProfileBufferSize */
+	volatile uint32 count;
+	uint32 threadId;
+};
+
+static ProfileBuffer *s_profileBuffers[kMaxProfileThreads];
+static uint32 s_numProfileBuffers = 0;
+
+#ifdef POSIX
+
+static pthread_mutex_t s_profileMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t s_profileKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t s_profileKey;
+
+static void createProfileKey() {
+	pthread_key_create(&s_profileKey, 0);
+}
+
+static void lockProfileBuffers() {
+	pthread_mutex_lock(&s_profileMutex);
+}
+
+static void unlockProfileBuffers() {
+	pthread_mutex_unlock(&s_profileMutex);
+}
+
+#else
+
+// Without thread local storage all threads share one buffer
+static void lockProfileBuffers() {
+}
+
+static void unlockProfileBuffers() {
+}
+
+#endif
+
+/**
+ * Return the ring buffer of the calling thread, creating it on first use.
+ * Buffers are never freed, since a thread may still be recording while the
+ * trace is saved. Returns NULL once kMaxProfileThreads threads have one.
+ */
+static ProfileBuffer *getProfileBuffer() {
+#ifdef POSIX
+	pthread_once(&s_profileKeyOnce, createProfileKey);
+	ProfileBuffer *buffer = (ProfileBuffer *)pthread_getspecific(s_profileKey);
+	if (buffer)
+		return buffer;
+#else
+	if (s_numProfileBuffers)
+		return s_profileBuffers[0];
+	ProfileBuffer *buffer;
+#endif
+
+	lockProfileBuffers();
+	if (s_numProfileBuffers >= kMaxProfileThreads) {
+		unlockProfileBuffers();
+		return 0;
+	}
+	buffer = new ProfileBuffer();
+	buffer->count = 0;
+	buffer->threadId = s_numProfileBuffers + 1;
+	s_profileBuffers[s_numProfileBuffers++] = buffer;
+	unlockProfileBuffers();
+
+#ifdef POSIX
+	pthread_setspecific(s_profileKey, buffer);
+#endif
+	return buffer;
+}
+
+ProfileZone::ProfileZone(const char *name) : _name(name), _start(getProfileMicros()) {
+}
+
+ProfileZone::~ProfileZone() {
+	ProfileBuffer *buffer = getProfileBuffer();
+	if (!buffer)
+		return;
+
+	uint32 count = buffer->count;
+	ProfileEvent &event = buffer->events[count % kProfileBufferSize];
+	event.name = _name;
+	event.start = _start;
+	event.end = getProfileMicros();
+	buffer->count = count + 1;
+}
+
+bool saveProfileTrace(const String &fileName) {
+	DumpFile file;
+	if (!file.open(fileName)) {
+		warning("Could not open profile trace file '%s'", fileName.c_str());
+		return false;
+	}
+
+	lockProfileBuffers();
+	file.writeString("{\"traceEvents\":[\n");
+	for (uint32 i = 0; i < s_numProfileBuffers; i++) {
+		const ProfileBuffer *buffer = s_profileBuffers[i];
+		uint32 count = buffer->count;
+		uint32 begin = 0;
+		if (count > kProfileBufferSize - kProfileExportMargin)
+			begin = count - (kProfileBufferSize - kProfileExportMargin);
+
+		file.writeString(String::format("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}",
+			i ? ",\n" : "", buffer->threadId, buffer->threadId));
+
+		for (uint32 n = begin; n != count; n++) {
+			const ProfileEvent &event = buffer->events[n % kProfileBufferSize];
+			file.writeString(String::format(",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%u,\"dur\":%u}",
+				event.name, buffer->threadId, event.start, event.end - event.start));
+		}
+	}
+	file.writeString("\n]}\n");
+	unlockProfileBuffers();
+
+	file.finalize();
+	bool ok = !file.err();
+	file.close();
+	if (!ok)
+		warning("Could not write profile trace file '%s'", fileName.c_str());
+	return ok;
+}
+
+void clearProfileTrace() {
+	lockProfileBuffers();
+	for (uint32 i = 0; i < s_numProfileBuffers; i++)
+		s_profileBuffers[i]->count = 0;
+	unlockProfileBuffers();
+}
+
+} // End of namespace Common
+
+#endif // ENABLE_PROFILE_ZONES
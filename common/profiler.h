@@ -0,0 +1,106 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_PROFILER_H
+#define COMMON_PROFILER_H
+
+#include "common/scummsys.h"
+
+/**
+ * Scoped profiling zones.
+ *
+ * Put PROFILE_ZONE("name") at the top of a block to record the wall time
+ * spent in it. The name must be a string literal, since only the pointer
+ * is stored. On POSIX systems every thread records into its own ring
+ * buffer, which keeps the most recent kProfileBufferSize zones, so zones
+ * are safe to use in the mixer and timer threads. Elsewhere all threads
+ * share one buffer.
+ *
+ * saveProfileTrace() writes the recorded zones in the Chrome trace event
+ * format, which can be opened in chrome://tracing or Perfetto.
+ *
+ * The zones compile to nothing unless configure was run with
+ * --enable-profile-zones.
+ */
+
+namespace Common {
+
+/**
+ * Return a wall clock time in microseconds, for timing short intervals.
+ * Only differences between two values are meaningful. Where configure
+ * found clock_gettime() it is a monotonic clock which is not affected by
+ * the event recorder. Elsewhere it falls back to getMillis(), which has
+ * millisecond precision and returns the recorded time during playback.
+ *
+ * This is available even when profiling zones are disabled.
+ */
+uint32 getProfileMicros();
+
+} // End of namespace Common
+
+#ifdef ENABLE_PROFILE_ZONES
+
+namespace Common {
+
+class String;
+
+enum {
+	kProfileBufferSize = 65536
+};
+
+class ProfileZone {
+public:
+	explicit ProfileZone(const char *name);
+	~ProfileZone();
+
+private:
+	const char *_name;
+	uint32 _start;
+};
+
+/**
+ * Write the zones recorded so far to the given file.
+ *
+ * Zones which are being recorded by other threads at the same time may
+ * be missing from the trace.
+ *
+ * @param fileName	path of the JSON file to write
+ * @return true on success, false if the file could not be written
+ */
+bool saveProfileTrace(const String &fileName);
+
+/** Discard all recorded zones. */
+void clearProfileTrace();
+
+} // End of namespace Common
+
+#define PROFILE_ZONE_CONCAT_(a, b) a##b
+#define PROFILE_ZONE_CONCAT(a, b) PROFILE_ZONE_CONCAT_(a, b)
+#define PROFILE_ZONE(name) Common::ProfileZone PROFILE_ZONE_CONCAT(profileZone, __LINE__)(name)
+
+#else
+
+#define PROFILE_ZONE(name) do {} while (0)
+
+#endif // ENABLE_PROFILE_ZONES
+
+#endif
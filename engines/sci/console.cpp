@@ -54,6 +54,7 @@
 #include "sci/video/seq_decoder.h"
 #ifdef ENABLE_SCI32
 #include "common/memstream.h"
+#include "sci/graphics/celobj32.h"
 #include "sci/graphics/frameout.h"
 #include "sci/graphics/paint32.h"
 #include "sci/graphics/palette32.h"
@@ -120,6 +121,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("hexgrep",			WRAP_METHOD(Console, cmdHexgrep));
 	registerCmd("verify_scripts",		WRAP_METHOD(Console, cmdVerifyScripts));
 	registerCmd("integrity_dump",	WRAP_METHOD(Console, cmdResourceIntegrityDump));
+	registerCmd("decompress_benchmark",	WRAP_METHOD(Console, cmdDecompressBenchmark));
 	// Game
 	registerCmd("save_game",			WRAP_METHOD(Console, cmdSaveGame));
 	registerCmd("restore_game",		WRAP_METHOD(Console, cmdRestoreGame));
@@ -148,6 +150,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("pi",                 WRAP_METHOD(Console, cmdPlaneItemList));	// alias
 	registerCmd("visible_plane_items", WRAP_METHOD(Console, cmdVisiblePlaneItemList));
 	registerCmd("vpi",                WRAP_METHOD(Console, cmdVisiblePlaneItemList));	// alias
+	registerCmd("cel_cache",          WRAP_METHOD(Console, cmdCelCache));
 	registerCmd("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	registerCmd("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
 	// Segments
@@ -163,6 +166,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
 	registerCmd("gc_normalize",		WRAP_METHOD(Console, cmdGCNormalize));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	// Music/SFX
 	registerCmd("songlib",			WRAP_METHOD(Console, cmdSongLib));
 	registerCmd("songinfo",			WRAP_METHOD(Console, cmdSongInfo));
@@ -341,6 +345,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" hexgrep - Searches some resources for a particular sequence of bytes, represented as hexadecimal numbers\n");
 	debugPrintf(" verify_scripts - Performs sanity checks on SCI1.1-SCI2.1 game scripts (e.g. if they're up to 64KB in total)\n");
 	debugPrintf(" integrity_dump - Dumps integrity data about resources in the current game to disk\n");
+	debugPrintf(" decompress_benchmark - Measures how fast resources of a type are decompressed\n");
 	debugPrintf("\n");
 	debugPrintf("Game:\n");
 	debugPrintf(" save_game - Saves the current game state to the hard disk\n");
@@ -365,6 +370,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" visible_plane_list / vpl - Shows a list of all the planes in the visible draw list (SCI2+)\n");
 	debugPrintf(" plane_items / pi - Shows a list of all items for a plane (SCI2+)\n");
 	debugPrintf(" visible_plane_items / vpi - Shows a list of all items for a plane in the visible draw list (SCI2+)\n");
+	debugPrintf(" cel_cache - Shows statistics of the cel cache (SCI2+)\n");
 	debugPrintf(" saved_bits - List saved bits on the hunk\n");
 	debugPrintf(" show_saved_bits - Display saved bits\n");
 	debugPrintf("\n");
@@ -379,6 +385,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
 	debugPrintf(" gc_normalize - Prints the \"normal\" address of a given address\n");
+	debugPrintf(" gc_stats - Shows garbage collection statistics, like pause times\n");
 	debugPrintf("\n");
 	debugPrintf("Music/SFX:\n");
 	debugPrintf(" songlib - Shows the song library\n");
@@ -1164,6 +1171,30 @@ bool Console::cmdHexgrep(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdDecompressBenchmark(int argc, const char **argv) {
+	if (argc != 2) {
+		debugPrintf("Decompresses all resources of a type again and shows how long it took.\n");
+		debugPrintf("Usage: %s <resource type>\n", argv[0]);
+		cmdResourceTypes(argc, argv);
+		return true;
+	}
+
+	ResourceType resType = parseResourceType(argv[1]);
+	if (resType == kResourceTypeInvalid) {
+		debugPrintf("Resource type '%s' is not valid\n", argv[1]);
+		return true;
+	}
+
+	uint count;
+	uint32 size;
+	const uint32 time = _engine->getResMan()->benchmarkDecompression(resType, count, size);
+	debugPrintf("Decompressed %u resources (%u KB) in %u ms", count, size / 1024, time);
+	if (time)
+		debugPrintf(", %.1f MB/s", size / (time * 1024.0 * 1024.0 / 1000));
+	debugPrintf("\n");
+	return true;
+}
+
 bool Console::cmdVerifyScripts(int argc, const char **argv) {
 	if (getSciVersion() < SCI_VERSION_1_1) {
 		debugPrintf("This script check is only meant for SCI1.1-SCI3 games\n");
@@ -2134,6 +2165,23 @@ bool Console::cmdVisiblePlaneItemList(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdCelCache(int argc, const char **argv) {
+#ifdef ENABLE_SCI32
+	const CelCache *cache = CelObj::getCache();
+	if (cache) {
+		const uint32 lookups = cache->getHits() + cache->getMisses();
+		debugPrintf("Cel cache: %u cels, %u of %u KB\n", cache->getCount(), cache->getSize() / 1024, cache->getMaxSize() / 1024);
+		debugPrintf("Hits: %u, misses: %u (%.1f%% hit rate), evictions: %u\n", cache->getHits(), cache->getMisses(),
+					lookups ? cache->getHits() * 100.0 / lookups : 0.0, cache->getEvictions());
+	} else {
+		debugPrintf("This SCI version does not have a cel cache\n");
+	}
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 bool Console::cmdSavedBits(int argc, const char **argv) {
 	SegManager *segman = _engine->_gamestate->_segMan;
 	SegmentId id = segman->findSegmentByType(SEG_TYPE_HUNK);
@@ -2723,6 +2771,17 @@ bool Console::cmdGCInvoke(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	const EngineState::GCStatistics &stats = _engine->_gamestate->gcStats;
+
+	debugPrintf("Collections: %u, skipped: %u\n", stats.runs, stats.skipped);
+	debugPrintf("Pause: last %u us, max %u us, total %u us\n", stats.lastPause, stats.maxPause, stats.totalPause);
+	debugPrintf("Last collection: %u reachable, %u freed\n", stats.lastReachable, stats.lastFreed);
+	debugPrintf("Freed in total: %u\n", stats.totalFreed);
+	debugPrintf("Allocations since last collection: %u\n", _engine->_gamestate->_segMan->getAllocationsSinceGC());
+	return true;
+}
+
 bool Console::cmdGCObjects(int argc, const char **argv) {
 	AddrSet *use_map = findAllActiveReferences(_engine->_gamestate);
 
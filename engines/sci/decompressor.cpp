@@ -53,55 +53,51 @@ void Decompressor::init(Common::ReadStream *src, byte *dest, uint32 nPacked,
 	_nBits = 0;
 	_dwRead = _dwWrote = 0;
 	_dwBits = 0;
+	_inPos = _inSize = _inTotal = 0;
+}
+
+void Decompressor::fillInBuffer() {
+	_inPos = 0;
+	_inSize = 0;
+	if (_inTotal < _szPacked) {
+		_inSize = _src->read(_inBuffer, MIN<uint32>(kInBufferSize, _szPacked - _inTotal));
+		_inTotal += _inSize;
+	}
 }
 
 void Decompressor::fetchBitsMSB() {
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << (24 - _nBits);
+		_dwBits |= ((uint32)readPackedByte()) << (24 - _nBits);
 		_nBits += 8;
 		_dwRead++;
 	}
 }
 
-uint32 Decompressor::getBitsMSB(int n) {
-	// fetching more data to buffer if needed
-	if (_nBits < n)
-		fetchBitsMSB();
-	uint32 ret = _dwBits >> (32 - n);
-	_dwBits <<= n;
-	_nBits -= n;
-	return ret;
-}
-
-byte Decompressor::getByteMSB() {
-	return getBitsMSB(8);
-}
-
 void Decompressor::fetchBitsLSB() {
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << _nBits;
+		_dwBits |= ((uint32)readPackedByte()) << _nBits;
 		_nBits += 8;
 		_dwRead++;
 	}
 }
 
-uint32 Decompressor::getBitsLSB(int n) {
-	// fetching more data to buffer if needed
-	if (_nBits < n)
-		fetchBitsLSB();
-	uint32 ret = (_dwBits & ~(0xFFFFFFFFU << n));
-	_dwBits >>= n;
-	_nBits -= n;
-	return ret;
-}
-
-byte Decompressor::getByteLSB() {
-	return getBitsLSB(8);
-}
-
 void Decompressor::putByte(byte b) {
 	_dest[_dwWrote++] = b;
 }
+
+void Decompressor::copyBytes(uint32 offset, uint32 length) {
+	byte *dest = _dest + _dwWrote;
+	const byte *src = _dest + offset;
+	_dwWrote += length;
+
+	if (offset + length <= _dwWrote - length) {
+		memcpy(dest, src, length);
+	} else {
+		// Overlapping copy, has to be done byte by byte
+		while (length--)
+			*dest++ = *src++;
+	}
+}
 //-------------------------------
 //  Huffman decompressor
 //-------------------------------
@@ -116,6 +112,7 @@ int DecompressorHuffman::unpack(Common::ReadStream *src, byte *dest, uint32 nPac
 	terminator = _src->readByte() | 0x100;
 	_nodes = new byte [numnodes << 1];
 	_src->read(_nodes, numnodes << 1);
+	buildLookup(numnodes << 1);
 
 	while ((c = getc2()) != terminator && (c >= 0) && !isFinished())
 		putByte(c);
@@ -124,8 +121,53 @@ int DecompressorHuffman::unpack(Common::ReadStream *src, byte *dest, uint32 nPac
 	return _dwWrote == _szUnpacked ? 0 : 1;
 }
 
+void DecompressorHuffman::buildLookup(uint nodesSize) {
+	for (uint code = 0; code < ARRAYSIZE(_lookup); code++) {
+		LookupEntry &entry = _lookup[code];
+		uint node = 0;
+		byte bits = 0;
+
+		entry.type = kLookupNode;
+		while (node + 1 < nodesSize && _nodes[node + 1]) {
+			if (bits == kLookupBits)
+				break;
+
+			uint next;
+			if ((code >> (kLookupBits - 1 - bits++)) & 1) {
+				next = _nodes[node + 1] & 0x0F;
+				if (next == 0) {
+					entry.type = kLookupEscape;
+					break;
+				}
+			} else
+				next = _nodes[node + 1] >> 4;
+
+			if (node + (next << 1) + 1 >= nodesSize) {
+				// Broken tree, leave this path to getc2's tree walk
+				bits--;
+				break;
+			}
+			node += next << 1;
+		}
+
+		if (entry.type == kLookupNode && node + 1 < nodesSize && !_nodes[node + 1])
+			entry.type = kLookupLeaf;
+
+		entry.bits = bits;
+		entry.value = entry.type == kLookupLeaf ? (_nodes[node] | (_nodes[node + 1] << 8)) : node;
+	}
+}
+
 int16 DecompressorHuffman::getc2() {
-	byte *node = _nodes;
+	// Decode up to kLookupBits bits at once, then continue bit by bit
+	const LookupEntry &entry = _lookup[peekBitsMSB(kLookupBits)];
+	skipBitsMSB(entry.bits);
+	if (entry.type == kLookupLeaf)
+		return (int16)entry.value;
+	if (entry.type == kLookupEscape)
+		return getByteMSB() | 0x100;
+
+	byte *node = _nodes + entry.value;
 	int16 next;
 	while (node[1]) {
 		if (getBitsMSB(1)) {
@@ -221,11 +263,9 @@ int DecompressorLZW::unpackLZW(Common::ReadStream *src, byte *dest, uint32 nPack
 					// For me this seems a normal situation, It's necessary to handle it
 					warning("unpackLZW: Trying to write beyond the end of array(len=%d, destctr=%d, tok_len=%d)",
 					        _szUnpacked, _dwWrote, tokenlastlength);
-					for (int i = 0; _dwWrote < _szUnpacked; i++)
-						putByte(dest[tokenlist[token] + i]);
+					copyBytes(tokenlist[token], _szUnpacked - _dwWrote);
 				} else
-					for (int i = 0; i < tokenlastlength; i++)
-						putByte(dest[tokenlist[token] + i]);
+					copyBytes(tokenlist[token], tokenlastlength);
 			} else {
 				tokenlastlength = 1;
 				if (_dwWrote >= _szUnpacked)
@@ -285,6 +325,8 @@ int DecompressorLZW::unpackLZW1(Common::ReadStream *src, byte *dest, uint32 nPac
 				continue;
 			}
 			putByte(bitstring);
+			if (_dwWrote == _szUnpacked)
+				bExit = true;
 			lastbits = bitstring;
 			lastchar = (bitstring & 0xff);
 			decryptstart = 1;
@@ -314,14 +356,15 @@ int DecompressorLZW::unpackLZW1(Common::ReadStream *src, byte *dest, uint32 nPac
 				token = tokens[token].next;
 			}
 			lastchar = stak[stakptr++] = token & 0xff;
-			// put stack in buffer
-			while (stakptr > 0) {
-				putByte(stak[--stakptr]);
-				if (_dwWrote == _szUnpacked) {
-					bExit = true;
-					continue;
-				}
+			// put stack in buffer, without writing beyond its end
+			uint32 stakcount = stakptr;
+			if (stakcount >= _szUnpacked - _dwWrote) {
+				stakcount = _szUnpacked - _dwWrote;
+				bExit = true;
 			}
+			while (stakcount--)
+				_dest[_dwWrote++] = stak[--stakptr];
+			stakptr = 0;
 			// put token into record
 			if (_curtoken <= _endtoken) {
 				tokens[_curtoken].data = lastchar;
@@ -653,14 +696,16 @@ int DecompressorLZS::unpackLZS() {
 					warning("lzsDecomp: length mismatch");
 					return SCI_ERROR_DECOMPRESSION_ERROR;
 				}
-				copyComp(offs, clen);
+				if (!copyComp(offs, clen))
+					return SCI_ERROR_DECOMPRESSION_ERROR;
 			} else { // Eleven bit offset follows
 				offs = getBitsMSB(11);
 				if (!(clen = getCompLen())) {
 					warning("lzsDecomp: length mismatch");
 					return SCI_ERROR_DECOMPRESSION_ERROR;
 				}
-				copyComp(offs, clen);
+				if (!copyComp(offs, clen))
+					return SCI_ERROR_DECOMPRESSION_ERROR;
 			}
 		} else // Literal byte follows
 			putByte(getByteMSB());
@@ -699,11 +744,13 @@ uint32 DecompressorLZS::getCompLen() {
 	}
 }
 
-void DecompressorLZS::copyComp(int offs, uint32 clen) {
-	int hpos = _dwWrote - offs;
-
-	while (clen--)
-		putByte(_dest[hpos++]);
+bool DecompressorLZS::copyComp(int offs, uint32 clen) {
+	if ((uint32)offs > _dwWrote || clen > _szUnpacked - _dwWrote) {
+		warning("lzsDecomp: copy out of range");
+		return false;
+	}
+	copyBytes(_dwWrote - offs, clen);
+	return true;
 }
 
 #endif	// #ifdef ENABLE_SCI32
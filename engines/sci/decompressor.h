@@ -74,7 +74,15 @@ protected:
 	 * @param n		number of bits to get
 	 * @return n-bits number
 	 */
-	uint32 getBitsMSB(int n);
+	uint32 getBitsMSB(int n) {
+		// fetching more data to buffer if needed
+		if (_nBits < n)
+			fetchBitsMSB();
+		uint32 ret = _dwBits >> (32 - n);
+		_dwBits <<= n;
+		_nBits -= n;
+		return ret;
+	}
 
 	/**
 	 * Get a number of bits from _src stream, starting with the least
@@ -82,18 +90,64 @@ protected:
 	 * @param n		number of bits to get
 	 * @return n-bits number
 	 */
-	uint32 getBitsLSB(int n);
+	uint32 getBitsLSB(int n) {
+		// fetching more data to buffer if needed
+		if (_nBits < n)
+			fetchBitsLSB();
+		uint32 ret = (_dwBits & ~(0xFFFFFFFFU << n));
+		_dwBits >>= n;
+		_nBits -= n;
+		return ret;
+	}
+
+	/**
+	 * Get a number of bits from _src stream like getBitsMSB, without
+	 * consuming them.
+	 * @param n		number of bits to get, at most 25
+	 * @return n-bits number
+	 */
+	uint32 peekBitsMSB(int n) {
+		if (_nBits < n)
+			fetchBitsMSB();
+		return _dwBits >> (32 - n);
+	}
+
+	/**
+	 * Consume bits previously returned by peekBitsMSB.
+	 * @param n		number of bits to skip
+	 */
+	void skipBitsMSB(int n) {
+		_dwBits <<= n;
+		_nBits -= n;
+	}
 
 	/**
 	 * Get one byte from _src stream.
 	 * @return byte
 	 */
-	byte getByteMSB();
-	byte getByteLSB();
+	byte getByteMSB() {
+		return getBitsMSB(8);
+	}
+	byte getByteLSB() {
+		return getBitsLSB(8);
+	}
 
 	void fetchBitsMSB();
 	void fetchBitsLSB();
 
+	/**
+	 * Get the next byte of packed data. Packed data is read from _src in
+	 * blocks, never beyond the packed size; past it, zeroes are returned.
+	 * @return byte
+	 */
+	byte readPackedByte() {
+		if (_inPos == _inSize)
+			fillInBuffer();
+		return _inPos < _inSize ? _inBuffer[_inPos++] : 0;
+	}
+
+	void fillInBuffer();
+
 	/**
 	 * Write one byte into _dest stream
 	 * @param b byte to put
@@ -101,6 +155,15 @@ protected:
 
 	virtual void putByte(byte b);
 
+	/**
+	 * Copy a sequence of already unpacked bytes from _dest to the end of
+	 * the output. The sequence may overlap the bytes being written, which
+	 * repeats its start.
+	 * @param offset	offset of the sequence in _dest
+	 * @param length	number of bytes to copy
+	 */
+	void copyBytes(uint32 offset, uint32 length);
+
 	/**
 	 * Returns true if all expected data has been unpacked to _dest
 	 * and there is no more data in _src.
@@ -117,6 +180,15 @@ protected:
 	uint32 _dwWrote;	///< number of bytes written to _dest
 	Common::ReadStream *_src;
 	byte *_dest;
+
+	enum {
+		kInBufferSize = 4096
+	};
+
+	byte _inBuffer[kInBufferSize];	///< block of packed data read from _src
+	uint32 _inPos;		///< position of the next unread byte in _inBuffer
+	uint32 _inSize;		///< number of valid bytes in _inBuffer
+	uint32 _inTotal;	///< number of bytes read from _src into _inBuffer
 };
 
 /**
@@ -129,7 +201,30 @@ public:
 protected:
 	int16 getc2();
 
+	/**
+	 * Fills _lookup with the result of walking the tree along each possible
+	 * combination of the next kLookupBits bits.
+	 */
+	void buildLookup(uint nodesSize);
+
+	enum {
+		kLookupBits = 8
+	};
+
+	enum LookupType {
+		kLookupLeaf,	///< a leaf node was reached
+		kLookupEscape,	///< an escaped literal byte follows
+		kLookupNode		///< the walk continues at an inner node
+	};
+
+	struct LookupEntry {
+		byte type;		///< LookupType
+		byte bits;		///< number of bits consumed
+		uint16 value;	///< leaf value or inner node offset
+	};
+
 	byte *_nodes;
+	LookupEntry _lookup[1 << kLookupBits];
 };
 
 /**
@@ -190,7 +285,7 @@ public:
 protected:
 	int unpackLZS();
 	uint32 getCompLen();
-	void copyComp(int offs, uint32 clen);
+	bool copyComp(int offs, uint32 clen);
 };
 #endif
 
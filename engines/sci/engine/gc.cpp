@@ -22,6 +22,8 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/profiler.h"
+#include "common/system.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -181,6 +183,8 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 
 void run_gc(EngineState *s) {
 	SegManager *segMan = s->_segMan;
+	const uint32 startTime = Common::getProfileMicros();
+	uint32 freed = 0;
 
 	// Some debug stuff
 	debugC(kDebugLevelGC, "[GC] Running...");
@@ -193,6 +197,7 @@ void run_gc(EngineState *s) {
 
 	// Compute the set of all segments references currently in use.
 	AddrSet *activeRefs = findAllActiveReferences(s);
+	const uint32 reachable = activeRefs->size();
 
 	// Iterate over all segments, and check for each whether it
 	// contains stuff that can be collected.
@@ -214,6 +219,7 @@ void run_gc(EngineState *s) {
 				if (!activeRefs->contains(addr)) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
+					freed++;
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
@@ -226,6 +232,19 @@ void run_gc(EngineState *s) {
 
 	delete activeRefs;
 
+	segMan->resetAllocationsSinceGC();
+
+	EngineState::GCStatistics &stats = s->gcStats;
+	const uint32 pause = Common::getProfileMicros() - startTime;
+	stats.runs++;
+	stats.lastPause = pause;
+	stats.maxPause = MAX(stats.maxPause, pause);
+	stats.totalPause += pause;
+	stats.lastReachable = reachable;
+	stats.lastFreed = freed;
+	stats.totalFreed += freed;
+	debugC(kDebugLevelGC, "[GC] Done in %u us, %u reachable, %u freed", pause, reachable, freed);
+
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
 	debugC(kDebugLevelGC, "[GC] Summary:");
@@ -67,6 +67,14 @@ enum {
 
 #define HUGE_DISTANCE 0xFFFFFFFF
 
+// Edge grid cells are at least this many pixels wide and high
+#define EDGE_GRID_MIN_CELL_SIZE 16
+// Maximum number of edge grid cells per row and column
+#define EDGE_GRID_MAX_CELLS 32
+
+// Visibility graphs of polygon sets with more vertices are not cached
+#define VISIBILITY_CACHE_MAX_VERTICES 1024
+
 #define VERTEX_HAS_EDGES(V) ((V) != CLIST_NEXT(V))
 
 // Error codes
@@ -117,23 +125,31 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// A* set membership, and the order in which vertices entered the open set
+	bool open;
+	bool closed;
+	uint32 openOrder;
+
+	// Index into the cached visibility graph, or -1 if the vertex isn't part
+	// of it
+	int cacheIndex;
+
+	// Last edge grid query which tested the edge starting at this vertex
+	uint32 gridStamp;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = NULL;
+		open = false;
+		closed = false;
+		openOrder = 0;
+		cacheIndex = -1;
+		gridStamp = 0;
 	}
 };
 
-class VertexList: public Common::List<Vertex *> {
-public:
-	bool contains(Vertex *v) {
-		for (iterator it = begin(); it != end(); ++it) {
-			if (v == *it)
-				return true;
-		}
-		return false;
-	}
-};
+typedef Common::List<Vertex *> VertexList;
 
 /* Circular list definitions. */
 
@@ -263,6 +279,23 @@ struct PathfindingState {
 	// Screen size
 	int _width, _height;
 
+	// Uniform grid over the polygon edges. Cell i holds the edges
+	// _gridEdges[_gridCells[i]] up to _gridEdges[_gridCells[i + 1]]
+	Common::Point _gridOrigin;
+	int _gridCellWidth, _gridCellHeight;
+	int _gridColumns, _gridRows;
+	Common::Array<uint> _gridCells;
+	Common::Array<Vertex *> _gridEdges;
+	uint32 _gridStamp;
+
+	// Cached visibility graph of the polygon vertices, or NULL if the cache
+	// can't be used for this polygon set
+	byte *_visibility;
+	uint _cachedVertices;
+
+	// Set when merging the start or end point split a polygon edge
+	bool _edgeSplit;
+
 	PathfindingState(int width, int height) : _width(width), _height(height) {
 		vertex_start = NULL;
 		vertex_end = NULL;
@@ -270,6 +303,12 @@ struct PathfindingState {
 		_prependPoint = NULL;
 		_appendPoint = NULL;
 		vertices = 0;
+		_gridCellWidth = _gridCellHeight = 1;
+		_gridColumns = _gridRows = 0;
+		_gridStamp = 0;
+		_visibility = NULL;
+		_cachedVertices = 0;
+		_edgeSplit = false;
 	}
 
 	~PathfindingState() {
@@ -286,6 +325,10 @@ struct PathfindingState {
 	bool pointOnScreenBorder(const Common::Point &p);
 	bool edgeOnScreenBorder(const Common::Point &p, const Common::Point &q);
 	int findNearPoint(const Common::Point &p, Polygon *polygon, Common::Point *ret);
+
+	void buildEdgeGrid();
+	bool lineBlocked(const Common::Point &a, const Common::Point &b);
+	bool isVisible(Vertex *a, Vertex *b);
 };
 
 static Common::Point readPoint(SegmentRef list_r, int offset) {
@@ -711,34 +754,172 @@ static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 	for (int i = 0; i < s->vertices; i++) {
 		Vertex *vertex = s->vertex_index[i];
 
-		// Make sure we don't intersect a polygon locally at the vertices
-		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
-			continue;
+		if (s->isVisible(vertex_cur, vertex))
+			visVerts->push_front(vertex);
+	}
+
+	return visVerts;
+}
+
+/**
+ * Builds the uniform grid used by lineBlocked(). Every edge is added to all
+ * cells overlapped by its bounding box.
+ */
+void PathfindingState::buildEdgeGrid() {
+	_gridColumns = _gridRows = 0;
+	_gridCells.clear();
+	_gridEdges.clear();
+
+	if (vertices == 0)
+		return;
+
+	Common::Point minPoint = vertex_index[0]->v;
+	Common::Point maxPoint = vertex_index[0]->v;
+	for (int i = 1; i < vertices; i++) {
+		const Common::Point &p = vertex_index[i]->v;
+		minPoint.x = MIN(minPoint.x, p.x);
+		minPoint.y = MIN(minPoint.y, p.y);
+		maxPoint.x = MAX(maxPoint.x, p.x);
+		maxPoint.y = MAX(maxPoint.y, p.y);
+	}
+
+	const int width = maxPoint.x - minPoint.x + 1;
+	const int height = maxPoint.y - minPoint.y + 1;
+	_gridOrigin = minPoint;
+	_gridCellWidth = MAX(EDGE_GRID_MIN_CELL_SIZE, (width + EDGE_GRID_MAX_CELLS - 1) / EDGE_GRID_MAX_CELLS);
+	_gridCellHeight = MAX(EDGE_GRID_MIN_CELL_SIZE, (height + EDGE_GRID_MAX_CELLS - 1) / EDGE_GRID_MAX_CELLS);
+	_gridColumns = (width + _gridCellWidth - 1) / _gridCellWidth;
+	_gridRows = (height + _gridCellHeight - 1) / _gridCellHeight;
+
+	// First pass counts the edges per cell, second pass stores them
+	_gridCells.resize(_gridColumns * _gridRows + 1);
+	Common::Array<uint> fill;
+	for (int pass = 0; pass < 2; pass++) {
+		for (int i = 0; i < vertices; i++) {
+			Vertex *edge = vertex_index[i];
+			if (!VERTEX_HAS_EDGES(edge))
+				continue;
 
-		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
-				if (between(vertex_cur->v, vertex->v, edge->v)) {
+			const Common::Point &p = edge->v;
+			const Common::Point &q = CLIST_NEXT(edge)->v;
+			const int left = (MIN(p.x, q.x) - _gridOrigin.x) / _gridCellWidth;
+			const int right = (MAX(p.x, q.x) - _gridOrigin.x) / _gridCellWidth;
+			const int top = (MIN(p.y, q.y) - _gridOrigin.y) / _gridCellHeight;
+			const int bottom = (MAX(p.y, q.y) - _gridOrigin.y) / _gridCellHeight;
+
+			for (int row = top; row <= bottom; row++) {
+				for (int column = left; column <= right; column++) {
+					const int cell = row * _gridColumns + column;
+					if (pass == 0)
+						_gridCells[cell + 1]++;
+					else
+						_gridEdges[fill[cell]++] = edge;
+				}
+			}
+		}
+
+		if (pass == 0) {
+			// Turn the counts into offsets
+			for (uint cell = 1; cell < _gridCells.size(); cell++)
+				_gridCells[cell] += _gridCells[cell - 1];
+			_gridEdges.resize(_gridCells.back());
+			fill = _gridCells;
+		}
+	}
+}
+
+/**
+ * Checks whether any polygon edge blocks the line between two points. Only
+ * the edges in the grid cells crossed by the line are tested.
+ * @param a		the start point of the line
+ * @param b		the end point of the line
+ * @return true if the line intersects an edge, false otherwise
+ */
+bool PathfindingState::lineBlocked(const Common::Point &a, const Common::Point &b) {
+	const int ax = a.x - _gridOrigin.x, ay = a.y - _gridOrigin.y;
+	const int bx = b.x - _gridOrigin.x, by = b.y - _gridOrigin.y;
+	const int minY = MIN(ay, by), maxY = MAX(ay, by);
+
+	_gridStamp++;
+
+	for (int row = minY / _gridCellHeight; row <= maxY / _gridCellHeight && row < _gridRows; row++) {
+		// Horizontal range of the line within this row, widened by one pixel
+		// to account for rounding
+		int x0, x1;
+		if (a == b) {
+			// between() treats every point on the same scanline as lying
+			// on a zero-length line, so check the whole row
+			x0 = 0;
+			x1 = (_gridColumns - 1) * _gridCellWidth;
+		} else if (ay == by) {
+			x0 = MIN(ax, bx);
+			x1 = MAX(ax, bx);
+		} else {
+			const int y0 = MAX(minY, row * _gridCellHeight);
+			const int y1 = MIN(maxY, (row + 1) * _gridCellHeight);
+			const int xa = ax + (int)((int64)(bx - ax) * (y0 - ay) / (by - ay));
+			const int xb = ax + (int)((int64)(bx - ax) * (y1 - ay) / (by - ay));
+			x0 = MIN(xa, xb) - 1;
+			x1 = MAX(xa, xb) + 1;
+		}
+
+		const int left = MAX(x0, 0) / _gridCellWidth;
+		const int right = MIN(x1 / _gridCellWidth, _gridColumns - 1);
+
+		for (int column = left; column <= right; column++) {
+			const int cell = row * _gridColumns + column;
+
+			for (uint i = _gridCells[cell]; i < _gridCells[cell + 1]; i++) {
+				Vertex *edge = _gridEdges[i];
+
+				// Edges spanning several cells are only tested once
+				if (edge->gridStamp == _gridStamp)
+					continue;
+				edge->gridStamp = _gridStamp;
+
+				if (between(a, b, edge->v)) {
 					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
-						break;
+					if ((inside(a, edge)) || (inside(b, edge)))
+						return true;
 
 					// This edge won't properly intersect, so we continue
 					continue;
 				}
 
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
-					break;
+				if (intersect_proper(a, b, edge->v, CLIST_NEXT(edge)->v))
+					return true;
 			}
 		}
+	}
 
-		if (j == s->vertices)
-			visVerts->push_front(vertex);
+	return false;
+}
+
+/**
+ * Determines whether two vertices can see each other. The result for two
+ * polygon vertices is taken from the visibility cache, if available.
+ * @param a		the first vertex
+ * @param b		the second vertex
+ * @return true if b is visible from a, false otherwise
+ */
+bool PathfindingState::isVisible(Vertex *a, Vertex *b) {
+	byte *cached = NULL;
+	if (_visibility && a->cacheIndex >= 0 && b->cacheIndex >= 0) {
+		cached = &_visibility[a->cacheIndex * _cachedVertices + b->cacheIndex];
+		if (*cached)
+			return *cached == 1;
 	}
 
-	return visVerts;
+	// Make sure we don't intersect a polygon locally at the vertices
+	const bool visible = (a != b) && !inside(b->v, a) && !inside(a->v, b) && !lineBlocked(a->v, b->v);
+
+	// Visibility is symmetric, so fill in both entries
+	if (cached) {
+		*cached = visible ? 1 : 2;
+		_visibility[b->cacheIndex * _cachedVertices + a->cacheIndex] = *cached;
+	}
+
+	return visible;
 }
 
 /**
@@ -1129,6 +1310,7 @@ static Vertex *merge_point(PathfindingState *s, const Common::Point &v) {
 				if (between(vertex->v, next->v, v)) {
 					// Split edge by adding vertex
 					polygon->vertices.insertAfter(vertex, v_new);
+					s->_edgeSplit = true;
 					return v_new;
 				}
 			}
@@ -1231,6 +1413,44 @@ static void change_polygons_opt_0(PathfindingState *s) {
 	}
 }
 
+/**
+ * Sets up the visibility cache for a polygon set. The cached visibility graph
+ * of the previous call is kept if the polygons haven't changed, otherwise a
+ * new empty one is started.
+ * @param cache		the visibility cache
+ * @param s			the pathfinding state
+ */
+static void setupVisibilityCache(EngineState::AvoidPathCache &cache, PathfindingState *s) {
+	Common::Array<int16> polygons;
+	uint vertices = 0;
+
+	for (PolygonList::iterator it = s->polygons.begin(); it != s->polygons.end(); ++it) {
+		Polygon *polygon = *it;
+		Vertex *vertex;
+
+		polygons.push_back(polygon->type);
+		polygons.push_back(polygon->vertices.size());
+		CLIST_FOREACH(vertex, &polygon->vertices) {
+			vertex->cacheIndex = vertices++;
+			polygons.push_back(vertex->v.x);
+			polygons.push_back(vertex->v.y);
+		}
+	}
+
+	if (vertices == 0 || vertices > VISIBILITY_CACHE_MAX_VERTICES)
+		return;
+
+	if (cache.vertices != vertices || cache.polygons != polygons) {
+		cache.polygons = polygons;
+		cache.vertices = vertices;
+		cache.visibility.clear();
+		cache.visibility.resize(vertices * vertices);
+	}
+
+	s->_visibility = &cache.visibility[0];
+	s->_cachedVertices = vertices;
+}
+
 /**
  * Converts the SCI input data for pathfinding
  * Parameters: (EngineState *) s: The game state
@@ -1322,10 +1542,17 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 		}
 	}
 
+	setupVisibilityCache(s->_avoidPathCache, pf_s);
+
 	// Merge start and end points into polygon set
 	pf_s->vertex_start = merge_point(pf_s, *new_start);
 	pf_s->vertex_end = merge_point(pf_s, *new_end);
 
+	// Splitting an edge changes the visibility between the other vertices
+	// as well, so the cache can't be used
+	if (pf_s->_edgeSplit)
+		pf_s->_visibility = NULL;
+
 	delete new_start;
 	delete new_end;
 
@@ -1344,10 +1571,79 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 	}
 
 	pf_s->vertices = count;
+	pf_s->buildEdgeGrid();
 
 	return pf_s;
 }
 
+// Entry of the A* open set. Stale entries, superseded by a lower F cost or
+// left behind after the vertex was closed, are skipped when popped.
+struct OpenSetEntry {
+	uint32 costF;
+	uint32 order;
+	Vertex *vertex;
+
+	// Lowest F cost first. Ties go to the vertex which entered the open set
+	// last, matching the linear scan over a list this replaces.
+	bool before(const OpenSetEntry &other) const {
+		return costF < other.costF || (costF == other.costF && order > other.order);
+	}
+};
+
+/**
+ * Binary min-heap of open set entries
+ */
+class OpenSet {
+public:
+	bool empty() const {
+		return _heap.empty();
+	}
+
+	void push(Vertex *vertex) {
+		OpenSetEntry entry;
+		entry.costF = vertex->costF;
+		entry.order = vertex->openOrder;
+		entry.vertex = vertex;
+
+		uint i = _heap.size();
+		_heap.push_back(entry);
+		while (i > 0) {
+			const uint parent = (i - 1) / 2;
+			if (!_heap[i].before(_heap[parent]))
+				break;
+			SWAP(_heap[i], _heap[parent]);
+			i = parent;
+		}
+	}
+
+	OpenSetEntry pop() {
+		const OpenSetEntry top = _heap[0];
+		_heap[0] = _heap.back();
+		_heap.pop_back();
+
+		const uint size = _heap.size();
+		uint i = 0;
+		for (;;) {
+			uint best = i;
+			const uint left = 2 * i + 1;
+			const uint right = left + 1;
+			if (left < size && _heap[left].before(_heap[best]))
+				best = left;
+			if (right < size && _heap[right].before(_heap[best]))
+				best = right;
+			if (best == i)
+				break;
+			SWAP(_heap[i], _heap[best]);
+			i = best;
+		}
+
+		return top;
+	}
+
+private:
+	Common::Array<OpenSetEntry> _heap;
+};
+
 /**
  * Computes a shortest path from vertex_start to vertex_end. The caller can
  * construct the resulting path by following the path_prev links from
@@ -1356,40 +1652,34 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
  * Parameters: (PathfindingState *) s: The pathfinding state
  */
 static void AStar(PathfindingState *s) {
-	// Vertices of which the shortest path is known
-	VertexList closedSet;
-
-	// The remaining vertices
-	VertexList openSet;
+	// The vertices which may be expanded next. Vertices of which the
+	// shortest path is known are flagged as closed.
+	OpenSet openSet;
+	uint32 openCount = 0;
+	bool found = false;
 
-	openSet.push_front(s->vertex_start);
 	s->vertex_start->costG = 0;
 	s->vertex_start->costF = (uint32)sqrt((float)s->vertex_start->v.sqrDist(s->vertex_end->v));
+	s->vertex_start->open = true;
+	s->vertex_start->openOrder = openCount++;
+	openSet.push(s->vertex_start);
 
 	while (!openSet.empty()) {
 		// Find vertex in open set with lowest F cost
-		VertexList::iterator vertex_min_it = openSet.end();
-		Vertex *vertex_min = 0;
-		uint32 min = HUGE_DISTANCE;
+		const OpenSetEntry entry = openSet.pop();
+		Vertex *vertex_min = entry.vertex;
 
-		for (VertexList::iterator it = openSet.begin(); it != openSet.end(); ++it) {
-			Vertex *vertex = *it;
-			if (vertex->costF < min) {
-				vertex_min_it = it;
-				vertex_min = *vertex_min_it;
-				min = vertex->costF;
-			}
-		}
-
-		assert(vertex_min != 0);	// the vertex cost should never be bigger than HUGE_DISTANCE
+		if (vertex_min->closed || entry.costF != vertex_min->costF)
+			continue;
 
 		// Check if we are done
-		if (vertex_min == s->vertex_end)
+		if (vertex_min == s->vertex_end) {
+			found = true;
 			break;
+		}
 
 		// Move vertex from set open to set closed
-		closedSet.push_front(vertex_min);
-		openSet.erase(vertex_min_it);
+		vertex_min->closed = true;
 
 		VertexList *visVerts = visible_vertices(s, vertex_min);
 
@@ -1397,11 +1687,13 @@ static void AStar(PathfindingState *s) {
 			uint32 new_dist;
 			Vertex *vertex = *it;
 
-			if (closedSet.contains(vertex))
+			if (vertex->closed)
 				continue;
 
-			if (!openSet.contains(vertex))
-				openSet.push_front(vertex);
+			if (!vertex->open) {
+				vertex->open = true;
+				vertex->openOrder = openCount++;
+			}
 
 			new_dist = vertex_min->costG + (uint32)sqrt((float)vertex_min->v.sqrDist(vertex->v));
 
@@ -1439,13 +1731,14 @@ static void AStar(PathfindingState *s) {
 				vertex->costG = new_dist;
 				vertex->costF = vertex->costG + (uint32)sqrt((float)vertex->v.sqrDist(s->vertex_end->v));
 				vertex->path_prev = vertex_min;
+				openSet.push(vertex);
 			}
 		}
 
 		delete visVerts;
 	}
 
-	if (openSet.empty())
+	if (!found)
 		debugC(kDebugLevelAvoidPath, "AvoidPath: End point (%i, %i) is unreachable", s->vertex_end->v.x, s->vertex_end->v.y);
 }
 
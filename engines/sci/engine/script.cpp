@@ -73,6 +73,28 @@ void Script::freeScript(const bool keepLocalsSegment) {
 	_offsetLookupObjectCount = 0;
 	_offsetLookupStringCount = 0;
 	_offsetLookupSaidCount = 0;
+
+	_decodedInstructions.clear();
+	_decodedInstructionIndex.clear();
+}
+
+const DecodedInstruction &Script::decodeInstruction(uint32 offset) {
+	DecodedInstruction instruction;
+	instruction.size = readPMachineInstruction(getBuf(offset), instruction.extOpcode, instruction.opparams);
+
+	// The index only has room for 65535 instructions, anything beyond that
+	// is decoded every time
+	if (_decodedInstructions.size() >= 0xFFFF) {
+		_overflowInstruction = instruction;
+		return _overflowInstruction;
+	}
+
+	if (_decodedInstructionIndex.empty())
+		_decodedInstructionIndex.resize(getBufSize());
+
+	_decodedInstructions.push_back(instruction);
+	_decodedInstructionIndex[offset] = _decodedInstructions.size();
+	return _decodedInstructions.back();
 }
 
 enum {
@@ -69,6 +69,16 @@ struct offsetLookupArrayEntry {
 
 typedef Common::Array<offsetLookupArrayEntry> offsetLookupArrayType;
 
+/**
+ * A PMachine instruction with its operands already read from the script
+ * buffer, see Script::getInstruction().
+ */
+struct DecodedInstruction {
+	int16 opparams[4];
+	uint16 size;        ///< Size of the instruction in bytes
+	byte extOpcode;
+};
+
 class Script : public SegmentObj {
 private:
 	int _nr; /**< Script number */
@@ -102,6 +112,19 @@ private:
 	uint16 _offsetLookupStringCount;
 	uint16 _offsetLookupSaidCount;
 
+	/**
+	 * Instructions which have been executed so far, decoded. Scripts mix
+	 * code and data, so instructions are decoded when they are executed
+	 * for the first time instead of in one pass at load time.
+	 */
+	Common::Array<DecodedInstruction> _decodedInstructions;
+	/** Index + 1 into _decodedInstructions for every buffer offset, 0 if not decoded yet */
+	Common::Array<uint16> _decodedInstructionIndex;
+
+	DecodedInstruction _overflowInstruction; ///< Instruction which did not fit into the index
+
+	const DecodedInstruction &decodeInstruction(uint32 offset);
+
 public:
 	int getLocalsOffset() const { return _localsOffset; }
 	uint16 getLocalsCount() const { return _localsCount; }
@@ -288,6 +311,17 @@ public:
 	uint16 getOffsetStringCount() { return _offsetLookupStringCount; };
 	uint16 getOffsetSaidCount() { return _offsetLookupSaidCount; };
 
+	/**
+	 * Returns the PMachine instruction starting at the given offset of the
+	 * script buffer. The instruction is decoded only once, later calls
+	 * return the cached result.
+	 */
+	const DecodedInstruction &getInstruction(uint32 offset) {
+		if (offset < _decodedInstructionIndex.size() && _decodedInstructionIndex[offset])
+			return _decodedInstructions[_decodedInstructionIndex[offset] - 1];
+		return decodeInstruction(offset);
+	}
+
 	/**
 	 * @returns kNoRelocation if no relocation exists for the given offset,
 	 * otherwise returns a delta for the offset to its relocated position.
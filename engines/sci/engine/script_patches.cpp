@@ -18135,7 +18135,7 @@ ScriptPatcher::~ScriptPatcher() {
 }
 
 // will actually patch previously found signature area
-void ScriptPatcher::applyPatch(const SciScriptPatcherEntry *patchEntry, SciSpan<byte> scriptData, int32 signatureOffset) {
+int32 ScriptPatcher::applyPatch(const SciScriptPatcherEntry *patchEntry, SciSpan<byte> scriptData, int32 signatureOffset) {
 	const uint16 *patchData = patchEntry->patchData;
 	byte orgData[PATCH_VALUELIMIT];
 	int32 offset = signatureOffset;
@@ -18240,6 +18240,7 @@ void ScriptPatcher::applyPatch(const SciScriptPatcherEntry *patchEntry, SciSpan<
 		patchData++;
 		patchWord = *patchData;
 	}
+	return offset;
 }
 
 bool ScriptPatcher::verifySignature(uint32 byteOffset, const uint16 *signatureData, const char *signatureDescription, const SciSpan<const byte> &scriptData) {
@@ -18328,6 +18329,35 @@ bool ScriptPatcher::verifySignature(uint32 byteOffset, const uint16 *signatureDa
 	return false;
 }
 
+// returns the number of script bytes covered by a signature
+static uint32 getSignatureSize(const uint16 *signatureData) {
+	uint32 size = 0;
+	uint16 sigWord = *signatureData;
+	while (sigWord != SIG_END) {
+		switch (sigWord & SIG_COMMANDMASK) {
+		case SIG_CODE_ADDTOOFFSET:
+			size += sigWord & SIG_VALUEMASK;
+			break;
+		case SIG_CODE_UINT16:
+			signatureData++;
+			size += 2;
+			break;
+		case SIG_CODE_SELECTOR16:
+			size += 2;
+			break;
+		case SIG_CODE_SELECTOR8:
+		case SIG_CODE_BYTE:
+			size++;
+			break;
+		default:
+			break;
+		}
+		signatureData++;
+		sigWord = *signatureData;
+	}
+	return size;
+}
+
 // will return -1 if no match was found, otherwise an offset to the start of the signature match
 int32 ScriptPatcher::findSignature(uint32 magicDWord, int magicOffset, const uint16 *signatureData, const char *patchDescription, const SciSpan<const byte> &scriptData) {
 	if (scriptData.size() < 4) // we need to find a DWORD, so less than 4 bytes is not okay
@@ -18351,8 +18381,84 @@ int32 ScriptPatcher::findSignature(uint32 magicDWord, int magicOffset, const uin
 	return -1;
 }
 
-int32 ScriptPatcher::findSignature(const SciScriptPatcherEntry *patchEntry, const SciScriptPatcherRuntimeEntry *runtimeEntry, const SciSpan<const byte> &scriptData) {
-	return findSignature(runtimeEntry->magicDWord, runtimeEntry->magicOffset, patchEntry->signatureData, patchEntry->description, scriptData);
+static inline uint64 magicDWordFilterBit(uint32 magicDWord) {
+	return (uint64)1 << ((magicDWord * 2654435761U) >> 26);
+}
+
+void ScriptPatcher::addMagicDWordOffsets(const SciScriptPatcherScriptIndex &scriptIndex, const SciSpan<const byte> &scriptData, uint32 fromOffset, uint32 toOffset, Common::Array<Common::Array<uint32> > &magicDWordOffsets) {
+	if (scriptData.size() < 4) // we need to find a DWORD, so less than 4 bytes is not okay
+		return;
+
+	const byte *data = scriptData.getUnsafeDataAt(0, scriptData.size());
+	const uint32 searchLimit = MIN<uint32>(toOffset, scriptData.size() - 3);
+	for (uint32 DWordOffset = fromOffset; DWordOffset < searchLimit; DWordOffset++) {
+		// magic DWords are in platform-specific BE/LE form, just like this one
+		const uint32 DWord = READ_UINT32(data + DWordOffset);
+		if (!(scriptIndex.magicDWordFilter & magicDWordFilterBit(DWord)))
+			continue;
+
+		for (uint i = 0; i < scriptIndex.entries.size(); i++) {
+			if (_runtimeTable[scriptIndex.entries[i]].magicDWord != DWord)
+				continue;
+
+			Common::Array<uint32> &offsets = magicDWordOffsets[i];
+			uint insertPos = offsets.size();
+			while (insertPos > 0 && offsets[insertPos - 1] > DWordOffset)
+				insertPos--;
+			if (insertPos == 0 || offsets[insertPos - 1] != DWordOffset)
+				offsets.insert_at(insertPos, DWordOffset);
+		}
+	}
+}
+
+// Does the same as calling findSignature() and applyPatch() for every entry of the script, but only
+//  searches the script data once for the magic DWORDs of all entries
+void ScriptPatcher::findAndApplyPatches(const SciScriptPatcherEntry *patchTable, const SciScriptPatcherScriptIndex &scriptIndex, uint16 scriptNr, SciSpan<byte> scriptData, Common::Array<SciScriptPatcherAppliedPatch> &appliedPatches) {
+	Common::Array<Common::Array<uint32> > magicDWordOffsets;
+	magicDWordOffsets.resize(scriptIndex.entries.size());
+	addMagicDWordOffsets(scriptIndex, scriptData, 0, scriptData.size(), magicDWordOffsets);
+
+	for (uint i = 0; i < scriptIndex.entries.size(); i++) {
+		const uint16 entryIndex = scriptIndex.entries[i];
+		const SciScriptPatcherEntry *curEntry = &patchTable[entryIndex];
+		const SciScriptPatcherRuntimeEntry *curRuntimeEntry = &_runtimeTable[entryIndex];
+		if (!curRuntimeEntry->active)
+			continue;
+
+		int32 foundOffset = 0;
+		int16 applyCount = curEntry->applyCount;
+		do {
+			const Common::Array<uint32> &offsets = magicDWordOffsets[i];
+			foundOffset = -1;
+			for (uint j = 0; j < offsets.size(); j++) {
+				// the magic DWORD may have been overwritten by a patch in the meantime
+				if (scriptData.getUint32At(offsets[j]) != curRuntimeEntry->magicDWord)
+					continue;
+
+				uint32 offset = offsets[j] + curRuntimeEntry->magicOffset;
+				if (verifySignature(offset, curEntry->signatureData, curEntry->description, scriptData)) {
+					foundOffset = offset;
+					break;
+				}
+			}
+
+			if (foundOffset != -1) {
+				// found, so apply the patch
+				debugC(kDebugLevelScriptPatcher, "Script-Patcher: '%s' on script %d offset %d", curEntry->description, scriptNr, foundOffset);
+				int32 patchEndOffset = applyPatch(curEntry, scriptData, foundOffset);
+
+				SciScriptPatcherAppliedPatch appliedPatch;
+				appliedPatch.entryIndex = entryIndex;
+				appliedPatch.offset = foundOffset;
+				appliedPatch.endOffset = patchEndOffset;
+				appliedPatches.push_back(appliedPatch);
+
+				// the patched data may contain new occurrences of magic DWORDs
+				addMagicDWordOffsets(scriptIndex, scriptData, MAX<int32>(foundOffset - 3, 0), patchEndOffset, magicDWordOffsets);
+			}
+			applyCount--;
+		} while ((foundOffset != -1) && (applyCount));
+	}
 }
 
 // Attention: Magic DWord is returned using platform specific byte order. This is done on purpose for performance.
@@ -18517,6 +18623,21 @@ void ScriptPatcher::initSignature(const SciScriptPatcherEntry *patchTable) {
 
 		curEntry++; curRuntimeEntry++;
 	}
+
+	initScriptIndex(patchTable);
+}
+
+void ScriptPatcher::initScriptIndex(const SciScriptPatcherEntry *patchTable) {
+	const SciScriptPatcherEntry *curEntry = patchTable;
+	uint16 entryIndex = 0;
+
+	_scriptIndex.clear();
+	while (curEntry->signatureData) {
+		SciScriptPatcherScriptIndex &scriptIndex = _scriptIndex[curEntry->scriptNr];
+		scriptIndex.entries.push_back(entryIndex);
+		scriptIndex.magicDWordFilter |= magicDWordFilterBit(_runtimeTable[entryIndex].magicDWord);
+		curEntry++; entryIndex++;
+	}
 }
 
 // This method enables certain patches
@@ -18542,8 +18663,6 @@ void ScriptPatcher::enablePatch(const SciScriptPatcherEntry *patchTable, const c
 
 void ScriptPatcher::processScript(uint16 scriptNr, SciSpan<byte> scriptData) {
 	const SciScriptPatcherEntry *signatureTable = NULL;
-	const SciScriptPatcherEntry *curEntry = NULL;
-	SciScriptPatcherRuntimeEntry *curRuntimeEntry = NULL;
 	const Sci::SciGameId gameId = g_sci->getGameId();
 
 	switch (gameId) {
@@ -18786,24 +18905,79 @@ void ScriptPatcher::processScript(uint16 scriptNr, SciSpan<byte> scriptData) {
 			}
 		}
 
-		curEntry = signatureTable;
-		curRuntimeEntry = _runtimeTable;
-
-		while (curEntry->signatureData) {
-			if ((scriptNr == curEntry->scriptNr) && (curRuntimeEntry->active)) {
-				int32 foundOffset = 0;
-				int16 applyCount = curEntry->applyCount;
-				do {
-					foundOffset = findSignature(curEntry, curRuntimeEntry, scriptData);
-					if (foundOffset != -1) {
-						// found, so apply the patch
-						debugC(kDebugLevelScriptPatcher, "Script-Patcher: '%s' on script %d offset %d", curEntry->description, scriptNr, foundOffset);
-						applyPatch(curEntry, scriptData, foundOffset);
+		ScriptIndexMap::const_iterator scriptIndex = _scriptIndex.find(scriptNr);
+		if (scriptIndex == _scriptIndex.end())
+			return;
+
+		// The same patches get applied each time the same script data is loaded,
+		//  so the patches found the first time are remembered and applied again.
+		//  The size and checksum only select the candidates, each signature is
+		//  still verified at its remembered offset before patching
+		uint32 checksum = 0;
+		byte *data = scriptData.getUnsafeDataAt(0, scriptData.size());
+		for (uint32 i = 0; i < scriptData.size(); i++)
+			checksum = (checksum << 5) + checksum + data[i];
+
+		PatchCacheMap::const_iterator cacheEntry = _patchCache.find(scriptNr);
+		if (cacheEntry != _patchCache.end() && cacheEntry->_value.scriptSize == scriptData.size() && cacheEntry->_value.scriptChecksum == checksum) {
+			const Common::Array<SciScriptPatcherAppliedPatch> &patches = cacheEntry->_value.patches;
+			bool verified = true;
+			if (!cacheEntry->_value.signaturesOverlapPatches) {
+				// No signature covers bytes of an earlier patch, so all of them
+				//  can be verified on the unpatched data and nothing needs to be
+				//  undone on a mismatch
+				for (uint i = 0; i < patches.size() && verified; i++) {
+					const SciScriptPatcherEntry *curEntry = &signatureTable[patches[i].entryIndex];
+					verified = verifySignature(patches[i].offset, curEntry->signatureData, curEntry->description, scriptData);
+				}
+				if (verified) {
+					for (uint i = 0; i < patches.size(); i++) {
+						const SciScriptPatcherEntry *curEntry = &signatureTable[patches[i].entryIndex];
+						debugC(kDebugLevelScriptPatcher, "Script-Patcher: '%s' on script %d offset %d", curEntry->description, scriptNr, patches[i].offset);
+						applyPatch(curEntry, scriptData, patches[i].offset);
+					}
+					return;
+				}
+			} else {
+				// Signatures are verified one by one while patching, like the
+				//  full search does, so the original data is kept for undoing
+				const Common::Array<byte> originalData(data, scriptData.size());
+				for (uint i = 0; i < patches.size(); i++) {
+					const SciScriptPatcherEntry *curEntry = &signatureTable[patches[i].entryIndex];
+					if (!verifySignature(patches[i].offset, curEntry->signatureData, curEntry->description, scriptData)) {
+						verified = false;
+						break;
 					}
-					applyCount--;
-				} while ((foundOffset != -1) && (applyCount));
+					debugC(kDebugLevelScriptPatcher, "Script-Patcher: '%s' on script %d offset %d", curEntry->description, scriptNr, patches[i].offset);
+					applyPatch(curEntry, scriptData, patches[i].offset);
+				}
+				if (verified)
+					return;
+
+				memcpy(data, originalData.begin(), scriptData.size());
+			}
+
+			// The checksum matched different script data, search again
+			debugC(kDebugLevelScriptPatcher, "Script-Patcher: cached patches do not match script %d, searching again", scriptNr);
+		}
+
+		SciScriptPatcherCacheEntry &newCacheEntry = _patchCache[scriptNr];
+		newCacheEntry.scriptSize = scriptData.size();
+		newCacheEntry.scriptChecksum = checksum;
+		newCacheEntry.signaturesOverlapPatches = false;
+		newCacheEntry.patches.clear();
+		findAndApplyPatches(signatureTable, scriptIndex->_value, scriptNr, scriptData, newCacheEntry.patches);
+
+		const Common::Array<SciScriptPatcherAppliedPatch> &patches = newCacheEntry.patches;
+		for (uint i = 1; i < patches.size() && !newCacheEntry.signaturesOverlapPatches; i++) {
+			const int32 signatureStart = patches[i].offset;
+			const int32 signatureEnd = signatureStart + getSignatureSize(signatureTable[patches[i].entryIndex].signatureData);
+			for (uint j = 0; j < i; j++) {
+				if (signatureStart < patches[j].endOffset && patches[j].offset < signatureEnd) {
+					newCacheEntry.signaturesOverlapPatches = true;
+					break;
+				}
 			}
-			curEntry++; curRuntimeEntry++;
 		}
 	}
 }
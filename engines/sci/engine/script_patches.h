@@ -23,6 +23,9 @@
 #ifndef SCI_ENGINE_SCRIPT_PATCHES_H
 #define SCI_ENGINE_SCRIPT_PATCHES_H
 
+#include "common/array.h"
+#include "common/hashmap.h"
+
 #include "sci/sci.h"
 
 namespace Sci {
@@ -84,6 +87,31 @@ struct SciScriptPatcherRuntimeEntry {
 	int magicOffset;
 };
 
+// Patch table entries of one script, used to search for all of their magic
+// DWORDs in a single pass over the script data
+struct SciScriptPatcherScriptIndex {
+	Common::Array<uint16> entries; // patch table indexes, in table order
+	uint64 magicDWordFilter;       // one bit per hashed magic DWORD of the entries
+
+	SciScriptPatcherScriptIndex() : magicDWordFilter(0) {}
+};
+
+struct SciScriptPatcherAppliedPatch {
+	uint16 entryIndex;
+	int32 offset;
+	int32 endOffset;
+};
+
+// Patches that got applied to a script, so that they can be applied again
+// without searching when the same script data gets loaded again
+struct SciScriptPatcherCacheEntry {
+	uint32 scriptSize;
+	uint32 scriptChecksum;
+	// set, when a signature covers bytes changed by an earlier patch
+	bool signaturesOverlapPatches;
+	Common::Array<SciScriptPatcherAppliedPatch> patches;
+};
+
 /**
  * ScriptPatcher class, handles on-the-fly patching of script data
  */
@@ -113,15 +141,27 @@ private:
 	// Enables a patch inside the patch table (used for optional patches like CD+Text support for KQ6 & LB2)
 	void enablePatch(const SciScriptPatcherEntry *patchTable, const char *searchDescription);
 
-	// Searches for a given signature entry inside script data
-	// returns -1 in case it was not found or an offset to the matching data
-	int32 findSignature(const SciScriptPatcherEntry *patchEntry, const SciScriptPatcherRuntimeEntry *runtimeEntry, const SciSpan<const byte> &scriptData);
+	// Groups the entries of a patch table by script number
+	void initScriptIndex(const SciScriptPatcherEntry *patchTable);
+
+	// Searches the given script data range for the magic DWORDs of the entries of a script
+	// and adds the offsets of all occurrences to the (sorted) offset lists of the entries
+	void addMagicDWordOffsets(const SciScriptPatcherScriptIndex &scriptIndex, const SciSpan<const byte> &scriptData, uint32 fromOffset, uint32 toOffset, Common::Array<Common::Array<uint32> > &magicDWordOffsets);
+
+	// Searches for the signatures of all entries of a script and applies the patches
+	void findAndApplyPatches(const SciScriptPatcherEntry *patchTable, const SciScriptPatcherScriptIndex &scriptIndex, uint16 scriptNr, SciSpan<byte> scriptData, Common::Array<SciScriptPatcherAppliedPatch> &appliedPatches);
 
 	// Applies a patch to a given script + offset (overwrites parts)
-	void applyPatch(const SciScriptPatcherEntry *patchEntry, SciSpan<byte> scriptData, int32 signatureOffset);
+	// returns the offset right after the patched data
+	int32 applyPatch(const SciScriptPatcherEntry *patchEntry, SciSpan<byte> scriptData, int32 signatureOffset);
+
+	typedef Common::HashMap<uint16, SciScriptPatcherScriptIndex> ScriptIndexMap;
+	typedef Common::HashMap<uint16, SciScriptPatcherCacheEntry> PatchCacheMap;
 
 	Selector *_selectorIdTable;
 	SciScriptPatcherRuntimeEntry *_runtimeTable;
+	ScriptIndexMap _scriptIndex;
+	PatchCacheMap _patchCache;
 	bool _isMacSci11;
 };
 
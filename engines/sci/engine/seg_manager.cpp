@@ -39,6 +39,7 @@ SegManager::SegManager(ResourceManager *resMan, ScriptPatcher *scriptPatcher)
 	_listsSegId = 0;
 	_nodesSegId = 0;
 	_hunksSegId = 0;
+	_allocationsSinceGC = 0;
 
 	_saveDirPtr = NULL_REG;
 	_parserPtr = NULL_REG;
@@ -63,6 +64,7 @@ void SegManager::resetSegMan() {
 	}
 
 	_heap.clear();
+	flushSelectorCache();
 
 	// And reinitialize
 	_heap.push_back(0);
@@ -71,6 +73,7 @@ void SegManager::resetSegMan() {
 	_listsSegId = 0;
 	_nodesSegId = 0;
 	_hunksSegId = 0;
+	_allocationsSinceGC = 0;
 
 #ifdef ENABLE_SCI32
 	_arraysSegId = 0;
@@ -180,6 +183,9 @@ void SegManager::deallocate(SegmentId seg) {
 		}
 	}
 
+	if (mobj->getType() == SEG_TYPE_SCRIPT)
+		flushSelectorCache();
+
 	delete mobj;
 	_heap[actualSegment] = NULL;
 }
@@ -403,6 +409,7 @@ reg_t SegManager::allocateHunkEntry(const char *hunk_type, int size) {
 	table = (HunkTable *)_heap[_hunksSegId];
 
 	offset = table->allocEntry();
+	_allocationsSinceGC++;
 
 	reg_t addr = make_reg(_hunksSegId, offset);
 	Hunk *h = &table->at(offset);
@@ -438,6 +445,7 @@ Clone *SegManager::allocateClone(reg_t *addr) {
 		table = (CloneTable *)_heap[_clonesSegId];
 
 	offset = table->allocEntry();
+	_allocationsSinceGC++;
 
 	*addr = make_reg(_clonesSegId, offset);
 	return &table->at(offset);
@@ -452,6 +460,7 @@ List *SegManager::allocateList(reg_t *addr) {
 	table = (ListTable *)_heap[_listsSegId];
 
 	offset = table->allocEntry();
+	_allocationsSinceGC++;
 
 	*addr = make_reg(_listsSegId, offset);
 	return &table->at(offset);
@@ -466,6 +475,7 @@ Node *SegManager::allocateNode(reg_t *addr) {
 	table = (NodeTable *)_heap[_nodesSegId];
 
 	offset = table->allocEntry();
+	_allocationsSinceGC++;
 
 	*addr = make_reg(_nodesSegId, offset);
 	return &table->at(offset);
@@ -893,6 +903,7 @@ SciArray *SegManager::allocateArray(SciArrayType type, uint16 size, reg_t *addr)
 		table = (ArrayTable *)_heap[_arraysSegId];
 
 	offset = table->allocEntry();
+	_allocationsSinceGC++;
 
 	*addr = make_reg(_arraysSegId, offset);
 
@@ -949,6 +960,7 @@ SciBitmap *SegManager::allocateBitmap(reg_t *addr, const int16 width, const int1
 	}
 
 	offset = table->allocEntry();
+	_allocationsSinceGC++;
 
 	*addr = make_reg(_bitmapSegId, offset);
 	SciBitmap &bitmap = table->at(offset);
@@ -1042,6 +1054,8 @@ int SegManager::instantiateScript(int scriptNum, bool applyScriptPatches) {
 		scr = allocateScript(scriptNum, &segmentId);
 	}
 
+	flushSelectorCache();
+
 	scr->load(scriptNum, _resMan, _scriptPatcher, applyScriptPatches);
 	scr->initializeLocals(this);
 	scr->initializeClasses(this);
@@ -1073,6 +1087,8 @@ void SegManager::uninstantiateScript(int script_nr) {
 		if (getClass(i).reg.getSegment() == segmentId)
 			setClassOffset(i, NULL_REG);
 
+	flushSelectorCache();
+
 	if (getSciVersion() < SCI_VERSION_1_1)
 		uninstantiateScriptSci0(script_nr);
 	// FIXME: Add proper script uninstantiation for SCI 1.1
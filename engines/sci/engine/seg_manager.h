@@ -46,6 +46,30 @@ enum ScriptLoadType {
 
 class Script;
 
+/**
+ * Cached result of a selector lookup, see lookupSelector().
+ */
+struct SelectorCacheEntry {
+	SelectorType type;
+	int varIndex; ///< Variable index, if type is kSelectorVariable
+	reg_t funcPos; ///< Method address, if type is kSelectorMethod
+};
+
+struct SelectorCacheKey {
+	reg_t obj;
+	Selector selector;
+
+	bool operator==(const SelectorCacheKey &other) const {
+		return obj == other.obj && selector == other.selector;
+	}
+};
+
+struct SelectorCacheKey_Hash {
+	uint operator()(const SelectorCacheKey &key) const {
+		return (key.obj.getSegment() << 20) ^ key.obj.getOffset() ^ ((uint)key.selector << 9);
+	}
+};
+
 class SegManager : public Common::Serializable {
 	friend class Console;
 public:
@@ -458,7 +482,42 @@ public:
 
 	const Common::Array<SegmentObj *> &getSegments() const { return _heap; }
 
+	/**
+	 * Number of objects allocated in garbage collected segments since the
+	 * last garbage collection.
+	 */
+	uint32 getAllocationsSinceGC() const { return _allocationsSinceGC; }
+	void resetAllocationsSinceGC() { _allocationsSinceGC = 0; }
+
+	/**
+	 * Looks up the cached result of a selector lookup on an object stored in
+	 * a script segment.
+	 * @return true if a result was cached
+	 */
+	bool lookupSelectorCache(reg_t obj, Selector selector, SelectorCacheEntry &entry) const {
+		SelectorCacheKey key = { obj, selector };
+		SelectorCache::const_iterator it = _selectorCache.find(key);
+		if (it == _selectorCache.end())
+			return false;
+		entry = it->_value;
+		return true;
+	}
+
+	void addToSelectorCache(reg_t obj, Selector selector, const SelectorCacheEntry &entry) {
+		SelectorCacheKey key = { obj, selector };
+		_selectorCache.setVal(key, entry);
+	}
+
+	/**
+	 * Forgets all cached selector lookups. Must be called whenever scripts
+	 * are loaded or unloaded, as this moves objects and classes around.
+	 */
+	void flushSelectorCache() { _selectorCache.clear(); }
+
 private:
+	typedef Common::HashMap<SelectorCacheKey, SelectorCacheEntry, SelectorCacheKey_Hash> SelectorCache;
+	SelectorCache _selectorCache; ///< Selector lookups on script objects
+
 	Common::Array<SegmentObj *> _heap;
 	Common::Array<Class> _classTable; /**< Table of all classes */
 	/** Map script ids to segment ids. */
@@ -472,6 +531,8 @@ private:
 	SegmentId _nodesSegId; ///< ID of the (a) node segment
 	SegmentId _hunksSegId; ///< ID of the (a) hunk segment
 
+	uint32 _allocationsSinceGC;
+
 	// Statically allocated memory for system strings
 	reg_t _saveDirPtr;
 	reg_t _parserPtr;
@@ -312,9 +312,54 @@ void invokeSelector(EngineState *s, reg_t object, int selectorId,
 	run_vm(s); // Start a new vm
 }
 
+/**
+ * Looks up a selector by walking the object's variables and the method
+ * dictionaries of its class chain.
+ */
+static SelectorCacheEntry lookupSelectorUncached(SegManager *segMan, const Object *obj, Selector selectorId) {
+	SelectorCacheEntry entry;
+	entry.varIndex = obj->locateVarSelector(segMan, selectorId);
+	entry.funcPos = NULL_REG;
+
+	if (entry.varIndex >= 0) {
+		// Found it as a variable
+		entry.type = kSelectorVariable;
+		return entry;
+	}
+
+	// Check if it's a method, with recursive lookup in superclasses
+	while (obj) {
+		int index = obj->funcSelectorPosition(selectorId);
+		if (index >= 0) {
+			entry.type = kSelectorMethod;
+			entry.funcPos = obj->getFunction(index);
+			return entry;
+		}
+
+		obj = segMan->getObject(obj->getSuperClassSelector());
+	}
+
+	entry.type = kSelectorNone;
+	return entry;
+}
+
+/**
+ * Looks up a selector on an object stored in a script segment. Classes and
+ * static instances only move when scripts are (un)loaded, so results are
+ * kept in the segment manager's selector cache.
+ */
+static SelectorCacheEntry lookupSelectorCached(SegManager *segMan, reg_t obj_location, const Object *obj, Selector selectorId) {
+	SelectorCacheEntry entry;
+	if (!segMan->lookupSelectorCache(obj_location, selectorId, entry)) {
+		entry = lookupSelectorUncached(segMan, obj, selectorId);
+		segMan->addToSelectorCache(obj_location, selectorId, entry);
+	}
+
+	return entry;
+}
+
 SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector selectorId, ObjVarRef *varp, reg_t *fptr) {
 	const Object *obj = segMan->getObject(obj_location);
-	int index;
 	bool oldScriptHeader = (getSciVersion() == SCI_VERSION_0_EARLY);
 
 	// Early SCI versions used the LSB in the selector ID as a read/write
@@ -327,34 +372,44 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x, %s", PRINT_REG(obj_location), origin.toString().c_str());
 	}
 
-	index = obj->locateVarSelector(segMan, selectorId);
-
-	if (index >= 0) {
-		// Found it as a variable
-		if (varp) {
-			varp->obj = obj_location;
-			varp->varindex = index;
-		}
-		return kSelectorVariable;
+	SelectorCacheEntry entry;
+	if (segMan->getSegmentType(obj_location.getSegment()) == SEG_TYPE_SCRIPT) {
+		entry = lookupSelectorCached(segMan, obj_location, obj, selectorId);
 	} else {
-		// Check if it's a method, with recursive lookup in superclasses
-		while (obj) {
-			index = obj->funcSelectorPosition(selectorId);
-			if (index >= 0) {
-				if (fptr)
-					*fptr = obj->getFunction(index);
-
-				return kSelectorMethod;
-			} else {
-				obj = segMan->getObject(obj->getSuperClassSelector());
+		// Clones may be freed and their slots reused at any time, so they
+		// are never cached themselves. Their variables are laid out like
+		// the ones of their class, which is in a script, though.
+		const reg_t classPos = obj->getSuperClassSelector();
+		const Object *classObj = segMan->getObject(classPos);
+
+		if (getSciVersion() == SCI_VERSION_3 || !classObj || segMan->getSegmentType(classPos.getSegment()) != SEG_TYPE_SCRIPT) {
+			entry = lookupSelectorUncached(segMan, obj, selectorId);
+		} else {
+			entry = lookupSelectorCached(segMan, classPos, classObj, selectorId);
+
+			if (entry.type != kSelectorVariable) {
+				// The clone's own method dictionary comes before the
+				// ones of its class chain
+				const int index = obj->funcSelectorPosition(selectorId);
+				if (index >= 0) {
+					entry.type = kSelectorMethod;
+					entry.funcPos = obj->getFunction(index);
+				}
 			}
 		}
-
-		return kSelectorNone;
 	}
 
+	if (entry.type == kSelectorVariable) {
+		if (varp) {
+			varp->obj = obj_location;
+			varp->varindex = entry.varIndex;
+		}
+	} else if (entry.type == kSelectorMethod) {
+		if (fptr)
+			*fptr = entry.funcPos;
+	}
 
-//	return _lookupSelector_function(segMan, obj, selectorId, fptr);
+	return entry.type;
 }
 
 } // End of namespace Sci
@@ -100,6 +100,11 @@ void EngineState::reset(bool isRestoring) {
 	lastWaitTime = 0;
 
 	gcCountDown = 0;
+	memset(&gcStats, 0, sizeof(gcStats));
+
+	_avoidPathCache.polygons.clear();
+	_avoidPathCache.vertices = 0;
+	_avoidPathCache.visibility.clear();
 
 #ifdef ENABLE_SCI32
 	_eventCounter = 0;
@@ -191,6 +191,28 @@ public:
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
 
+	/** Garbage collector statistics, shown by the gc_stats console command */
+	struct GCStatistics {
+		uint32 runs;            ///< Number of collections
+		uint32 skipped;         ///< Periodic collections skipped for lack of allocations
+		uint32 lastPause;       ///< Duration of the last collection, in microseconds
+		uint32 maxPause;        ///< Longest collection, in microseconds
+		uint32 totalPause;      ///< Time spent collecting, in microseconds
+		uint32 lastReachable;   ///< Reachable addresses found by the last collection
+		uint32 lastFreed;       ///< Addresses freed by the last collection
+		uint32 totalFreed;      ///< Addresses freed so far
+	} gcStats;
+
+	/**
+	 * Visibility graph of the polygon set last passed to kAvoidPath. It is
+	 * reused by subsequent calls for as long as the polygons stay the same.
+	 */
+	struct AvoidPathCache {
+		Common::Array<int16> polygons;  ///< Types and points of the polygons
+		uint vertices;                  ///< Number of polygon vertices
+		Common::Array<byte> visibility; ///< vertices x vertices matrix: 0 = unknown, 1 = visible, 2 = hidden
+	} _avoidPathCache;
+
 	MessageState *_msgState;
 
 	// MemorySegment provides access to a 256-byte block of memory that remains
@@ -199,6 +199,11 @@ static void write_var(EngineState *s, int type, int index, reg_t value) {
 		if (type == VAR_TEMP && value.getSegment() == kUninitializedSegment)
 			value.setSegment(0);
 
+		// Queue the resources of the next room, so they can be loaded while
+		// the game waits for its next cycle
+		if (index == kGlobalVarNewRoomNo && type == VAR_GLOBAL && value != s->variables[type][index] && value.isNumber())
+			g_sci->getResMan()->prefetchRoom(value.toUint16());
+
 		s->variables[type][index] = value;
 
 		g_sci->_guestAdditions->writeVarHook(type, index, value);
@@ -657,7 +662,16 @@ void run_vm(EngineState *s) {
 
 		// Get opcode
 		byte extOpcode;
-		s->xs->addr.pc.incOffset(readPMachineInstruction(scr->getBuf(s->xs->addr.pc.getOffset()), extOpcode, opparams));
+		if (g_sci->_debugState.debugging) {
+			// Read straight from the script while debugging, in case the
+			// script is being modified from the debugger
+			s->xs->addr.pc.incOffset(readPMachineInstruction(scr->getBuf(s->xs->addr.pc.getOffset()), extOpcode, opparams));
+		} else {
+			const DecodedInstruction &instruction = scr->getInstruction(s->xs->addr.pc.getOffset());
+			extOpcode = instruction.extOpcode;
+			memcpy(opparams, instruction.opparams, sizeof(opparams));
+			s->xs->addr.pc.incOffset(instruction.size);
+		}
 		const byte opcode = extOpcode >> 1;
 		//debug("%s: %d, %d, %d, %d, acc = %04x:%04x, script %d, local script %d", opcodeNames[opcode], opparams[0], opparams[1], opparams[2], opparams[3], PRINT_REG(s->r_acc), scr->getScriptNumber(), local_script->getScriptNumber());
 
@@ -883,7 +897,10 @@ void run_vm(EngineState *s) {
 			// Run the garbage collector, if needed
 			if (s->gcCountDown-- <= 0) {
 				s->gcCountDown = s->scriptGCInterval;
-				run_gc(s);
+				if (s->_segMan->getAllocationsSinceGC() >= GC_MIN_ALLOCATIONS)
+					run_gc(s);
+				else
+					s->gcStats.skipped++;
 			}
 
 			// Call kernel function
@@ -188,6 +188,17 @@ enum {
 	GC_INTERVAL = 0x8000
 };
 
+/**
+ * Minimum number of allocations since the last gc for the periodic gc to
+ * run. Objects can still become garbage without allocations, as soon as
+ * scripts drop their references, so skipping a collection does leave
+ * garbage behind. This is harmless because the heap cannot grow without
+ * allocations; the garbage is freed by the next collection that runs.
+ */
+enum {
+	GC_MIN_ALLOCATIONS = 64
+};
+
 enum SciOpcodes {
 	op_bnot     = 0x00,	// 000
 	op_add      = 0x01,	// 001
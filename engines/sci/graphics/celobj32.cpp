@@ -89,9 +89,8 @@ bool CelObj::_drawBlackLines = false;
 void CelObj::init() {
 	CelObj::deinit();
 	_drawBlackLines = false;
-	_nextCacheId = 1;
 	_scaler.reset(new CelScaler());
-	_cache.reset(new CelCache(100));
+	_cache.reset(new CelCache(kCelCacheSize));
 }
 
 void CelObj::deinit() {
@@ -664,45 +663,105 @@ void CelObj::submitPalette() const {
 #pragma mark -
 #pragma mark CelObj - Caching
 
-int CelObj::_nextCacheId = 1;
-Common::ScopedPtr<CelCache> CelObj::_cache;
+CelCache::CelCache(const uint32 maxSize) :
+	_first(nullptr),
+	_last(nullptr),
+	_size(0),
+	_maxSize(maxSize),
+	_hits(0),
+	_misses(0),
+	_evictions(0) {}
+
+CelCache::~CelCache() {
+	clear();
+}
 
-int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
-	*nextInsertIndex = -1;
-	int oldestId = _nextCacheId + 1;
-	int oldestIndex = 0;
+void CelCache::clear() {
+	while (_first) {
+		deleteEntry(_first);
+	}
+}
 
-	for (int i = 0, len = _cache->size(); i < len; ++i) {
-		CelCacheEntry &entry = (*_cache)[i];
+void CelCache::removeFromList(CelCacheEntry *const entry) {
+	if (entry->prev) {
+		entry->prev->next = entry->next;
+	} else {
+		_first = entry->next;
+	}
 
-		if (entry.celObj == nullptr) {
-			if (*nextInsertIndex == -1) {
-				*nextInsertIndex = i;
-			}
-		} else if (entry.celObj->_info == celInfo) {
-			entry.id = ++_nextCacheId;
-			return i;
-		} else if (oldestId > entry.id) {
-			oldestId = entry.id;
-			oldestIndex = i;
-		}
+	if (entry->next) {
+		entry->next->prev = entry->prev;
+	} else {
+		_last = entry->prev;
+	}
+
+	entry->prev = entry->next = nullptr;
+}
+
+void CelCache::addToList(CelCacheEntry *const entry) {
+	entry->prev = _last;
+	entry->next = nullptr;
+	if (_last) {
+		_last->next = entry;
+	} else {
+		_first = entry;
 	}
+	_last = entry;
+}
+
+void CelCache::deleteEntry(CelCacheEntry *const entry) {
+	removeFromList(entry);
+	_entries.erase(entry->celObj->_info);
+	_size -= entry->size;
+	delete entry;
+}
 
-	if (*nextInsertIndex == -1) {
-		*nextInsertIndex = oldestIndex;
+const CelObj *CelCache::find(const CelInfo32 &celInfo) {
+	EntryMap::const_iterator it = _entries.find(celInfo);
+	if (it == _entries.end()) {
+		++_misses;
+		return nullptr;
 	}
 
-	return -1;
+	++_hits;
+	CelCacheEntry *const entry = it->_value;
+	if (entry != _last) {
+		removeFromList(entry);
+		addToList(entry);
+	}
+	return entry->celObj.get();
 }
 
-void CelObj::putCopyInCache(const int cacheIndex) const {
-	if (cacheIndex == -1) {
-		error("Invalid cache index");
+void CelCache::put(CelObj *const celObj) {
+	EntryMap::const_iterator it = _entries.find(celObj->_info);
+	if (it != _entries.end()) {
+		deleteEntry(it->_value);
 	}
 
-	CelCacheEntry &entry = (*_cache)[cacheIndex];
-	entry.celObj.reset(duplicate());
-	entry.id = ++_nextCacheId;
+	CelCacheEntry *const entry = new CelCacheEntry();
+	entry->celObj.reset(celObj);
+	// Rebuilding a cel object means parsing its headers and, for most cels,
+	// scanning its pixels for remap colours, so entries are accounted by the
+	// amount of pixel data they describe
+	entry->size = sizeof(CelCacheEntry) + celObj->_width * celObj->_height;
+	_entries[celObj->_info] = entry;
+	addToList(entry);
+	_size += entry->size;
+
+	while (_size > _maxSize && _first != entry) {
+		deleteEntry(_first);
+		++_evictions;
+	}
+}
+
+Common::ScopedPtr<CelCache> CelObj::_cache;
+
+const CelObj *CelObj::searchCache(const CelInfo32 &celInfo) const {
+	return _cache->find(celInfo);
+}
+
+void CelObj::putCopyInCache() const {
+	_cache->put(duplicate());
 }
 
 #pragma mark -
@@ -946,16 +1005,13 @@ CelObjView::CelObjView(const GuiResourceId viewId, const int16 loopNo, const int
 	_compressionType = kCelCompressionInvalid;
 	_transparent = true;
 
-	int cacheInsertIndex;
-	const int cacheIndex = searchCache(_info, &cacheInsertIndex);
-	if (cacheIndex != -1) {
-		CelCacheEntry &entry = (*_cache)[cacheIndex];
-		const CelObjView *const cachedCelObj = dynamic_cast<CelObjView *>(entry.celObj.get());
+	const CelObj *const cacheEntry = searchCache(_info);
+	if (cacheEntry) {
+		const CelObjView *const cachedCelObj = dynamic_cast<const CelObjView *>(cacheEntry);
 		if (cachedCelObj == nullptr) {
-			error("Expected a CelObjView in cache slot %d", cacheIndex);
+			error("Expected a CelObjView in cache for %s", _info.toString().c_str());
 		}
 		*this = *cachedCelObj;
-		entry.id = ++_nextCacheId;
 		return;
 	}
 
@@ -1065,7 +1121,7 @@ CelObjView::CelObjView(const GuiResourceId viewId, const int16 loopNo, const int
 		_remap = analyzeForRemap();
 	}
 
-	putCopyInCache(cacheInsertIndex);
+	putCopyInCache();
 }
 
 bool CelObjView::analyzeUncompressedForRemap() const {
@@ -1165,16 +1221,13 @@ CelObjPic::CelObjPic(const GuiResourceId picId, const int16 celNo) {
 	_transparent = true;
 	_remap = false;
 
-	int cacheInsertIndex;
-	const int cacheIndex = searchCache(_info, &cacheInsertIndex);
-	if (cacheIndex != -1) {
-		CelCacheEntry &entry = (*_cache)[cacheIndex];
-		const CelObjPic *const cachedCelObj = dynamic_cast<CelObjPic *>(entry.celObj.get());
+	const CelObj *const cacheEntry = searchCache(_info);
+	if (cacheEntry) {
+		const CelObjPic *const cachedCelObj = dynamic_cast<const CelObjPic *>(cacheEntry);
 		if (cachedCelObj == nullptr) {
-			error("Expected a CelObjPic in cache slot %d", cacheIndex);
+			error("Expected a CelObjPic in cache for %s", _info.toString().c_str());
 		}
 		*this = *cachedCelObj;
-		entry.id = ++_nextCacheId;
 		return;
 	}
 
@@ -1238,7 +1291,7 @@ CelObjPic::CelObjPic(const GuiResourceId picId, const int16 celNo) {
 		}
 	}
 
-	putCopyInCache(cacheInsertIndex);
+	putCopyInCache();
 }
 
 bool CelObjPic::analyzeUncompressedForSkip() const {
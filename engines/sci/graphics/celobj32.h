@@ -23,6 +23,7 @@
 #ifndef SCI_GRAPHICS_CELOBJ32_H
 #define SCI_GRAPHICS_CELOBJ32_H
 
+#include "common/hashmap.h"
 #include "common/rational.h"
 #include "common/rect.h"
 #include "sci/resource.h"
@@ -105,7 +106,7 @@ struct CelInfo32 {
 
 	// This is the equivalence criteria used by CelObj::searchCache in at least
 	// SSCI SQ6. Notably, it does not check the color field.
-	inline bool operator==(const CelInfo32 &other) {
+	inline bool operator==(const CelInfo32 &other) const {
 		return (
 			type == other.type &&
 			resourceId == other.resourceId &&
@@ -115,7 +116,7 @@ struct CelInfo32 {
 		);
 	}
 
-	inline bool operator!=(const CelInfo32 &other) {
+	inline bool operator!=(const CelInfo32 &other) const {
 		return !(*this == other);
 	}
 
@@ -138,18 +139,88 @@ struct CelInfo32 {
 	}
 };
 
+struct CelInfo32_Hash {
+	uint operator()(const CelInfo32 &info) const {
+		uint hash = info.type;
+		hash = hash * 31 + info.resourceId;
+		hash = hash * 31 + (uint16)info.loopNo;
+		hash = hash * 31 + (uint16)info.celNo;
+		hash = hash * 31 + info.bitmap.getSegment();
+		return hash * 31 + info.bitmap.getOffset();
+	}
+};
+
+enum {
+	/**
+	 * The number of bytes of cel data the cel cache may account for.
+	 */
+	kCelCacheSize = 8 * 1024 * 1024
+};
+
 class CelObj;
 struct CelCacheEntry {
+	Common::ScopedPtr<CelObj> celObj;
+
 	/**
-	 * A monotonically increasing cache ID used to identify the least recently
-	 * used item in the cache for replacement.
+	 * The number of bytes this entry is accounted for in the cache budget.
 	 */
-	int id;
-	Common::ScopedPtr<CelObj> celObj;
-	CelCacheEntry() : id(0) {}
+	uint32 size;
+
+	/**
+	 * Neighbours in the cache's least recently used list.
+	 */
+	CelCacheEntry *prev, *next;
+
+	CelCacheEntry() : size(0), prev(nullptr), next(nullptr) {}
 };
 
-typedef Common::Array<CelCacheEntry> CelCache;
+/**
+ * A cache of cel objects, indexed by their CelInfo32. When the cached cels
+ * exceed the byte budget, the least recently used ones are evicted.
+ */
+class CelCache {
+public:
+	CelCache(const uint32 maxSize);
+	~CelCache();
+
+	/**
+	 * Returns the cached cel object matching the given CelInfo32, or null if
+	 * there is none.
+	 */
+	const CelObj *find(const CelInfo32 &celInfo);
+
+	/**
+	 * Puts the given cel object into the cache. The cache takes ownership of
+	 * the object.
+	 */
+	void put(CelObj *celObj);
+
+	void clear();
+
+	uint getCount() const { return _entries.size(); }
+	uint32 getSize() const { return _size; }
+	uint32 getMaxSize() const { return _maxSize; }
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+	uint32 getEvictions() const { return _evictions; }
+
+private:
+	typedef Common::HashMap<CelInfo32, CelCacheEntry *, CelInfo32_Hash> EntryMap;
+
+	EntryMap _entries;
+
+	/**
+	 * The least and most recently used entries.
+	 */
+	CelCacheEntry *_first, *_last;
+
+	uint32 _size, _maxSize;
+	uint32 _hits, _misses, _evictions;
+
+	void removeFromList(CelCacheEntry *entry);
+	void addToList(CelCacheEntry *entry);
+	void deleteEntry(CelCacheEntry *entry);
+};
 
 #pragma mark -
 #pragma mark CelScaler
@@ -447,12 +518,6 @@ private:
 #pragma mark -
 #pragma mark CelObj - Caching
 protected:
-	/**
-	 * A monotonically increasing cache ID used to identify the least recently
-	 * used item in the cache for replacement.
-	 */
-	static int _nextCacheId;
-
 	/**
 	 * A cache of cel objects used to avoid reinitialisation overhead for cels
 	 * with the same CelInfo32.
@@ -461,16 +526,20 @@ protected:
 
 	/**
 	 * Searches the cel cache for a CelObj matching the provided CelInfo32. If
-	 * not found, -1 is returned. `nextInsertIndex` will receive the index of
-	 * the oldest item in the cache, which can be used to replace the oldest
-	 * item with a newer item.
+	 * not found, null is returned.
 	 */
-	int searchCache(const CelInfo32 &celInfo, int *nextInsertIndex) const;
+	const CelObj *searchCache(const CelInfo32 &celInfo) const;
 
 	/**
-	 * Puts a copy of this CelObj into the cache at the given cache index.
+	 * Puts a copy of this CelObj into the cache.
+	 */
+	void putCopyInCache() const;
+
+public:
+	/**
+	 * Returns the cel cache, for debugging.
 	 */
-	void putCopyInCache(int index) const;
+	static const CelCache *getCache() { return _cache.get(); }
 };
 
 #pragma mark -
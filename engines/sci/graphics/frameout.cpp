@@ -957,17 +957,92 @@ void GfxFrameout::drawEraseList(const RectList &eraseList, const Plane &plane) {
 	}
 }
 
+enum {
+	/**
+	 * The number of uncovered fragments of a draw rect after which
+	 * isDrawItemHidden stops looking for opaque items covering it.
+	 */
+	kMaxHiddenItemFragments = 16
+};
+
+/**
+ * Determines whether drawing the given screen item writes every pixel of its
+ * draw rect. This is the case for solid colors and for unscaled, uncompressed
+ * cels without transparency or remapping.
+ */
+static bool isOpaque(const ScreenItem &screenItem) {
+	const CelObj &celObj = *screenItem._celObj;
+	if (celObj._info.type == kCelTypeColor) {
+		return true;
+	}
+
+	return !celObj._remap &&
+		!celObj._transparent &&
+		celObj._compressionType == kCelCompressionNone &&
+		screenItem._ratioX.isOne() &&
+		screenItem._ratioY.isOne();
+}
+
 void GfxFrameout::drawScreenItemList(const DrawList &screenItemList) {
 	const DrawList::size_type drawListSize = screenItemList.size();
+
+	Common::Array<DrawList::size_type> opaqueItems;
+	for (DrawList::size_type i = 0; i < drawListSize; ++i) {
+		if (isOpaque(*screenItemList[i]->screenItem)) {
+			opaqueItems.push_back(i);
+		}
+	}
+
 	for (DrawList::size_type i = 0; i < drawListSize; ++i) {
 		const DrawItem &drawItem = *screenItemList[i];
 		mergeToShowList(drawItem.rect, _showList, _overdrawThreshold);
+		if (isDrawItemHidden(screenItemList, i, opaqueItems)) {
+			continue;
+		}
 		const ScreenItem &screenItem = *drawItem.screenItem;
 		CelObj &celObj = *screenItem._celObj;
 		celObj.draw(_currentBuffer, screenItem, drawItem.rect, screenItem._mirrorX ^ celObj._mirrorX);
 	}
 }
 
+bool GfxFrameout::isDrawItemHidden(const DrawList &screenItemList, const DrawList::size_type index, const Common::Array<DrawList::size_type> &opaqueItems) const {
+	// The parts of the draw rect which have not been found to be covered yet
+	Common::Array<Common::Rect> visibleRects, uncoveredRects;
+	visibleRects.push_back(screenItemList[index]->rect);
+
+	for (uint i = 0; i < opaqueItems.size(); ++i) {
+		if (opaqueItems[i] <= index) {
+			continue;
+		}
+
+		const Common::Rect &coverRect = screenItemList[opaqueItems[i]]->rect;
+		uncoveredRects.clear();
+		for (uint j = 0; j < visibleRects.size(); ++j) {
+			Common::Rect outRects[4];
+			const int splitCount = splitRects(visibleRects[j], coverRect, outRects);
+			if (splitCount == -1) {
+				uncoveredRects.push_back(visibleRects[j]);
+			} else {
+				for (int k = 0; k < splitCount; ++k) {
+					uncoveredRects.push_back(outRects[k]);
+				}
+			}
+		}
+		visibleRects = uncoveredRects;
+
+		if (visibleRects.empty()) {
+			return true;
+		}
+
+		// Give up on items which are only covered by a patchwork of rects
+		if (visibleRects.size() > kMaxHiddenItemFragments) {
+			return false;
+		}
+	}
+
+	return false;
+}
+
 void GfxFrameout::mergeToShowList(const Common::Rect &drawRect, RectList &showList, const int overdrawThreshold) {
 	RectList mergeList;
 	Common::Rect merged;
@@ -364,6 +364,16 @@ private:
 	 */
 	void drawScreenItemList(const DrawList &screenItemList);
 
+	/**
+	 * Determines whether the given draw item is completely overdrawn by opaque
+	 * draw items later in the same draw list, in which case drawing it can be
+	 * skipped without changing the output.
+	 *
+	 * @param opaqueItems The indexes of all opaque items in the draw list, in
+	 * ascending order.
+	 */
+	bool isDrawItemHidden(const DrawList &screenItemList, const DrawList::size_type index, const Common::Array<DrawList::size_type> &opaqueItems) const;
+
 	/**
 	 * Adds a new rectangle to the list of regions to write out to the hardware.
 	 * The provided rect may be merged into an existing rectangle to reduce the
@@ -22,9 +22,12 @@
 
 // Resource library
 
+#include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
+#include "common/profiler.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #ifdef ENABLE_SCI32
@@ -209,6 +212,8 @@ Resource::Resource(ResourceManager *resMan, ResourceId id) : SciSpan<const byte>
 	_source = nullptr;
 	_header = nullptr;
 	_headerSize = 0;
+	_lruPrev = nullptr;
+	_lruNext = nullptr;
 }
 
 Resource::~Resource() {
@@ -418,6 +423,7 @@ void ResourceManager::disposeVolumeFileStream(Common::SeekableReadStream *fileSt
 }
 
 void ResourceManager::loadResource(Resource *res) {
+	PROFILE_ZONE("Sci::ResourceManager::loadResource");
 	res->_source->loadResource(this, res);
 }
 
@@ -623,6 +629,29 @@ void ResourceSource::loadResource(ResourceManager *resMan, Resource *res) {
 	resMan->disposeVolumeFileStream(fileStream, this);
 }
 
+uint32 ResourceManager::benchmarkDecompression(ResourceType type, uint &count, uint32 &size) {
+	count = 0;
+	size = 0;
+
+	const uint32 startTime = g_system->getMillis();
+	for (ResourceMap::const_iterator it = _resMap.begin(); it != _resMap.end(); ++it) {
+		const Resource *res = it->_value;
+		if (res->getType() != type || !res->_source || res->_source->getSourceType() != kSourceVolume)
+			continue;
+
+		Resource copy(this, res->_id);
+		copy._source = res->_source;
+		copy._fileOffset = res->_fileOffset;
+		res->_source->loadResource(this, &copy);
+		if (copy._data) {
+			count++;
+			size += copy.size();
+		}
+	}
+
+	return g_system->getMillis() - startTime;
+}
+
 Resource *ResourceManager::testResource(ResourceId id) {
 	return _resMap.getVal(id, NULL);
 }
@@ -990,7 +1019,9 @@ void ResourceManager::init() {
 	_maxMemoryLRU = 256 * 1024; // 256KiB
 	_memoryLocked = 0;
 	_memoryLRU = 0;
-	_LRU.clear();
+	_lruFirst = nullptr;
+	_lruLast = nullptr;
+	_prefetchQueue.clear();
 	_resMap.clear();
 	_audioMapSCI1 = NULL;
 #ifdef ENABLE_SCI32
@@ -1047,8 +1078,13 @@ void ResourceManager::init() {
 	// cache, leading to constant decompression of picture resources
 	// and making the renderer very slow.
 	if (getSciVersion() >= SCI_VERSION_2) {
-		_maxMemoryLRU = 4096 * 1024; // 4MiB
+		_maxMemoryLRU = 16 * 1024 * 1024; // 16MiB
+	}
+
+	if (!_detectionMode && ConfMan.hasKey("resource_cache") && ConfMan.getInt("resource_cache") > 0) {
+		_maxMemoryLRU = ConfMan.getInt("resource_cache") * 1024;
 	}
+	debugC(1, kDebugLevelResMan, "resMan: Resource cache size is %d KiB", _maxMemoryLRU / 1024);
 
 	switch (_viewType) {
 	case kViewEga:
@@ -1096,7 +1132,18 @@ void ResourceManager::removeFromLRU(Resource *res) {
 		warning("resMan: trying to remove resource that isn't enqueued");
 		return;
 	}
-	_LRU.remove(res);
+
+	if (res->_lruPrev)
+		res->_lruPrev->_lruNext = res->_lruNext;
+	else
+		_lruFirst = res->_lruNext;
+
+	if (res->_lruNext)
+		res->_lruNext->_lruPrev = res->_lruPrev;
+	else
+		_lruLast = res->_lruPrev;
+
+	res->_lruPrev = res->_lruNext = nullptr;
 	_memoryLRU -= res->size();
 	res->_status = kResStatusAllocated;
 }
@@ -1106,7 +1153,15 @@ void ResourceManager::addToLRU(Resource *res) {
 		warning("resMan: trying to enqueue resource with state %d", res->_status);
 		return;
 	}
-	_LRU.push_front(res);
+
+	res->_lruPrev = nullptr;
+	res->_lruNext = _lruFirst;
+	if (_lruFirst)
+		_lruFirst->_lruPrev = res;
+	else
+		_lruLast = res;
+	_lruFirst = res;
+
 	_memoryLRU += res->size();
 #if SCI_VERBOSE_RESMAN
 	debug("Adding %s (%d bytes) to lru control: %d bytes total",
@@ -1119,15 +1174,11 @@ void ResourceManager::addToLRU(Resource *res) {
 void ResourceManager::printLRU() {
 	int mem = 0;
 	int entries = 0;
-	Common::List<Resource *>::iterator it = _LRU.begin();
-	Resource *res;
 
-	while (it != _LRU.end()) {
-		res = *it;
+	for (Resource *res = _lruFirst; res; res = res->_lruNext) {
 		debug("\t%s: %u bytes", res->_id.toString().c_str(), res->size());
 		mem += res->size();
 		++entries;
-		++it;
 	}
 
 	debug("Total: %d entries, %d bytes (mgr says %d)", entries, mem, _memoryLRU);
@@ -1135,8 +1186,8 @@ void ResourceManager::printLRU() {
 
 void ResourceManager::freeOldResources() {
 	while (_maxMemoryLRU < _memoryLRU) {
-		assert(!_LRU.empty());
-		Resource *goner = _LRU.back();
+		assert(_lruLast);
+		Resource *goner = _lruLast;
 		removeFromLRU(goner);
 		goner->unalloc();
 #ifdef SCI_VERBOSE_RESMAN
@@ -1158,14 +1209,17 @@ Common::List<ResourceId> ResourceManager::listResources(ResourceType type, int m
 	return resources;
 }
 
-Resource *ResourceManager::findResource(ResourceId id, bool lock) {
-	// remap known incorrect audio36 and sync36 resource ids
+ResourceId ResourceManager::remapResourceId(ResourceId id) const {
 	if (id.getType() == kResourceTypeAudio36) {
-		id = remapAudio36ResourceId(id);
+		return remapAudio36ResourceId(id);
 	} else if (id.getType() == kResourceTypeSync36) {
-		id = remapSync36ResourceId(id);
+		return remapSync36ResourceId(id);
 	}
-	Resource *retval = testResource(id);
+	return id;
+}
+
+Resource *ResourceManager::findResource(ResourceId id, bool lock) {
+	Resource *retval = testResource(remapResourceId(id));
 
 	if (!retval)
 		return NULL;
@@ -1222,6 +1276,39 @@ void ResourceManager::unlockResource(Resource *res) {
 	freeOldResources();
 }
 
+void ResourceManager::prefetchRoom(uint16 roomNumber) {
+	static const ResourceType types[] = {
+		kResourceTypeScript, kResourceTypeHeap, kResourceTypePic, kResourceTypeView, kResourceTypePalette
+	};
+
+	_prefetchQueue.clear();
+
+	for (int i = 0; i < ARRAYSIZE(types); ++i) {
+		const ResourceId id(types[i], roomNumber);
+		const Resource *res = testResource(id);
+		if (res && res->_status == kResStatusNoMalloc)
+			_prefetchQueue.push_back(id);
+	}
+}
+
+bool ResourceManager::prefetchNextResource() {
+	while (!_prefetchQueue.empty()) {
+		const ResourceId id = _prefetchQueue.front();
+		_prefetchQueue.pop_front();
+
+		// Skip resources which have been loaded in the meantime
+		Resource *res = testResource(id);
+		if (!res || res->_status != kResStatusNoMalloc)
+			continue;
+
+		debugC(2, kDebugLevelResMan, "[resMan] Prefetching %s", id.toString().c_str());
+		findResource(id, false);
+		return true;
+	}
+
+	return false;
+}
+
 const char *ResourceManager::versionDescription(ResVersion version) const {
 	switch (version) {
 	case kResVersionUnknown:
@@ -2159,6 +2246,10 @@ Resource *ResourceManager::updateResource(ResourceId resId, ResourceSource *src,
 		if (res == nullptr) {
 			res = new Resource(this, resId);
 			_resMap.setVal(resId, res);
+		} else if (res->_status == kResStatusEnqueued) {
+			// Drop the old contents, they must not stay in the LRU queue
+			removeFromLRU(res);
+			res->unalloc();
 		}
 
 		res->_status = kResStatusNoMalloc;
@@ -298,6 +298,8 @@ protected:
 	uint16 _lockers; /**< Number of places where this resource was locked */
 	ResourceSource *_source;
 	ResourceManager *_resMan;
+	Resource *_lruPrev; /**< Next more recently used resource in the LRU queue */
+	Resource *_lruNext; /**< Next less recently used resource in the LRU queue */
 
 	bool loadPatch(Common::SeekableReadStream *file);
 	bool loadFromPatchFile();
@@ -366,6 +368,20 @@ public:
 	 */
 	void unlockResource(Resource *res);
 
+	/**
+	 * Queues the script, pic, view and palette resources numbered after the
+	 * given room, so that they can be loaded before the room asks for them.
+	 * @param roomNumber	The number of the room that is about to be entered
+	 */
+	void prefetchRoom(uint16 roomNumber);
+
+	/**
+	 * Loads the next queued prefetch resource into the LRU cache. Called
+	 * while the engine is idle.
+	 * @return false if there was nothing left to prefetch
+	 */
+	bool prefetchNextResource();
+
 	/**
 	 * Tests whether a resource exists.
 	 *
@@ -388,6 +404,17 @@ public:
 	 */
 	Common::List<ResourceId> listResources(ResourceType type, int mapNumber = -1);
 
+	/**
+	 * Decompresses all resources of the specified type that are stored in
+	 * resource volumes again, without touching the loaded copies. This is
+	 * used by the decompress_benchmark debugger command.
+	 * @param type		The resource type to decompress
+	 * @param count		Returns the number of decompressed resources
+	 * @param size		Returns the total size of the decompressed data
+	 * @return			The time spent, in milliseconds
+	 */
+	uint32 benchmarkDecompression(ResourceType type, uint &count, uint32 &size);
+
 	void setAudioLanguage(int language);
 	int getAudioLanguage() const;
 	void changeAudioDirectory(Common::String path);
@@ -423,6 +450,15 @@ public:
 	 */
 	int16 getCurrentDiscNo() const { return _currentDiscNo; }
 
+	/**
+	 * Creates a stream which reads an uncompressed audio or audio36 resource
+	 * directly from its audio volume, so the resource does not have to be
+	 * loaded into memory first. Returns NULL if the resource is not stored
+	 * in that way or has already been loaded, in which case the caller
+	 * should use findResource instead.
+	 */
+	Common::SeekableReadStream *makeAudioVolumeStream(ResourceId id);
+
 private:
 	/**
 	 * The currently active disc number.
@@ -472,6 +508,7 @@ protected:
 	// Note: maxMemory will not be interpreted as a hard limit, only as a restriction
 	// for resources which are not explicitly locked. However, a warning will be
 	// issued whenever this limit is exceeded.
+	// Can be overridden with the "resource_cache" config key (in KiB).
 	int _maxMemoryLRU;
 
 	ViewType _viewType; // Used to determine if the game has EGA or VGA graphics
@@ -479,7 +516,9 @@ protected:
 	SourcesList _sources;
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
 	int _memoryLRU;		///< Amount of resource bytes under LRU control
-	Common::List<Resource *> _LRU; ///< Last Resource Used list
+	Resource *_lruFirst; ///< Most recently used resource in the LRU queue
+	Resource *_lruLast;  ///< Least recently used resource, freed first
+	Common::List<ResourceId> _prefetchQueue; ///< Resources to load while the game is idle
 	ResourceMap _resMap;
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
 	ResourceSource *_audioMapSCI1; ///< Currently loaded audio map for SCI1
@@ -625,6 +664,9 @@ protected:
 
 private:
 	bool _hasBadResources;
+
+	/** Remaps known incorrect audio36 and sync36 resource ids. */
+	ResourceId remapResourceId(ResourceId id) const;
 };
 
 class SoundResource {
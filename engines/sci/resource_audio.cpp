@@ -23,7 +23,9 @@
 // Resource library
 
 #include "common/archive.h"
+#include "common/bufferedstream.h"
 #include "common/file.h"
+#include "common/substream.h"
 #include "common/textconsole.h"
 #include "common/memstream.h"
 #include "sci/resource.h"
@@ -1011,6 +1013,69 @@ void AudioVolumeResourceSource::loadResource(ResourceManager *resMan, Resource *
 	resMan->disposeVolumeFileStream(fileStream, this);
 }
 
+#ifdef ENABLE_SCI32
+Common::SeekableReadStream *ResourceManager::makeAudioVolumeStream(ResourceId id) {
+	// Reading audio from the volume in blocks of this size means the audio
+	// decoders do not hit the disk for every few samples they decode
+	const uint32 kReadAheadSize = 16384;
+
+	if (id.getType() != kResourceTypeAudio && id.getType() != kResourceTypeAudio36)
+		return nullptr;
+	id = remapResourceId(id);
+
+	Resource *res = testResource(id);
+	if (!res || res->_status != kResStatusNoMalloc || !res->_source || res->_source->getSourceType() != kSourceAudioVolume)
+		return nullptr;
+
+	ResourceSource *source = res->_source;
+	if (source->getAudioCompressionType() != 0)
+		return nullptr;
+
+	// The stream is read from the audio thread, so it must not share the
+	// volume file handle with the resource manager
+	Common::SeekableReadStream *file;
+	if (source->_resourceFile) {
+		file = source->_resourceFile->createReadStream();
+	} else {
+		Common::File *volumeFile = new Common::File();
+		if (!volumeFile->open(source->getLocationName())) {
+			delete volumeFile;
+			return nullptr;
+		}
+		file = volumeFile;
+	}
+	if (!file)
+		return nullptr;
+
+	// Determine the resource size the same way as loadFromAudioVolumeSCI11.
+	// Anything unexpected is left to the regular loading code, which
+	// reports it.
+	const uint32 offset = res->_fileOffset;
+	uint32 size = res->size();
+	file->seek(offset, SEEK_SET);
+	if (file->readUint32BE() == MKTAG('R','I','F','F')) {
+		size = file->readUint32LE() + 8;
+	} else {
+		file->seek(offset, SEEK_SET);
+		const ResourceType type = convertResType(file->readByte());
+		const uint8 headerSize = file->readByte();
+		if (type != kResourceTypeAudio || (headerSize != 7 && headerSize != 11 && headerSize != 12))
+			size = 0;
+		else if (headerSize != 7) {
+			file->seek(7, SEEK_CUR);
+			size = file->readUint32LE() + headerSize + kResourceHeaderSize;
+		}
+	}
+
+	if (!size || file->err() || file->eos() || offset + size > (uint32)file->size()) {
+		delete file;
+		return nullptr;
+	}
+
+	return Common::wrapBufferedSeekableReadStream(new Common::SeekableSubReadStream(file, offset, offset + size, DisposeAfterUse::YES), kReadAheadSize, DisposeAfterUse::YES);
+}
+#endif
+
 bool ResourceManager::addAudioSources() {
 #ifdef ENABLE_SCI32
 	// Multi-disc audio is added during addAppropriateSources for those titles
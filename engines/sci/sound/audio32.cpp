@@ -579,11 +579,13 @@ void Audio32::freeChannel(const int16 channelIndex) {
 		// We cannot unlock resources from the audio thread because
 		// ResourceManager is not thread-safe; instead, we just record that the
 		// resource needs unlocking and unlock it whenever we are on the main
-		// thread again
-		if (_inAudioThread) {
-			_resourcesToUnlock.push_back(channel.resource);
-		} else {
-			_resMan->unlockResource(channel.resource);
+		// thread again. Streamed audio has no resource to unlock.
+		if (channel.resource != nullptr) {
+			if (_inAudioThread) {
+				_resourcesToUnlock.push_back(channel.resource);
+			} else {
+				_resMan->unlockResource(channel.resource);
+			}
 		}
 
 		channel.resource = nullptr;
@@ -796,16 +798,20 @@ uint16 Audio32::play(int16 channelIndex, const ResourceId resourceId, const bool
 	// descriptor + offset that it can use to read streamed audio, or it has a
 	// memory ID that it can use to read cached audio.
 	//
-	// Here in ScummVM we just ask the resource manager to give us the resource
-	// and we get a seekable stream.
-
-	// TODO: This should be fixed to use streaming, which means fixing the
-	// resource manager to allow streaming, which means probably rewriting a
-	// bunch of the resource manager.
-	Resource *resource = _resMan->findResource(resourceId, true);
-	if (resource == nullptr) {
-		warning("[Audio32::play]: %s could not be found", resourceId.toString().c_str());
-		return 0;
+	// Here in ScummVM, audio which is stored uncompressed in an audio volume
+	// and not already cached is streamed from the volume, just like in SSCI.
+	// Anything else is requested from the resource manager, which gives us
+	// the resource and we get a seekable stream.
+	Common::SeekableReadStream *dataStream = _resMan->makeAudioVolumeStream(resourceId);
+	Resource *resource = nullptr;
+	if (dataStream == nullptr) {
+		resource = _resMan->findResource(resourceId, true);
+		if (resource == nullptr) {
+			warning("[Audio32::play]: %s could not be found", resourceId.toString().c_str());
+			return 0;
+		}
+
+		dataStream = resource->makeStream();
 	}
 
 	channelIndex = _numActiveChannels++;
@@ -823,8 +829,6 @@ uint16 Audio32::play(int16 channelIndex, const ResourceId resourceId, const bool
 		_monitoredChannelIndex = channelIndex;
 	}
 
-	Common::SeekableReadStream *dataStream = resource->makeStream();
-
 	Audio::RewindableAudioStream *audioStream;
 
 	if (detectSolAudio(*dataStream)) {
@@ -1374,7 +1378,7 @@ void Audio32::printAudioList(Console *con) const {
 		con->debugPrintf("  %d[%04x:%04x]: %s, started at %d, pos %d/%d, vol %d, pan %d%s%s\n",
 						 i,
 						 PRINT_REG(channel.soundNode),
-						 channel.robot ? "robot" : channel.resource->name().c_str(),
+						 channel.robot ? "robot" : channel.id.toString().c_str(),
 						 channel.startedAtTick,
 						 (g_sci->getTickCount() - channel.startedAtTick) % channel.duration,
 						 channel.duration,
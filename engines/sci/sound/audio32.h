@@ -51,7 +51,7 @@ struct AudioChannel {
 
 	/**
 	 * The resource loaded into this channel. The resource is owned by
-	 * ResourceManager.
+	 * ResourceManager. This is null for audio streamed from an audio volume.
 	 */
 	Resource *resource;
 
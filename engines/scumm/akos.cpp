@@ -335,10 +335,16 @@ void AkosRenderer::setPalette(uint16 *new_palette) {
 	}
 }
 
+AkosRenderer::~AkosRenderer() {
+	akos16ClearCache();
+}
+
 void AkosRenderer::setCostume(int costume, int shadow) {
 	const byte *akos = _vm->getResourceAddress(rtCostume, costume);
 	assert(akos);
 
+	_costume = costume;
+
 	akhd = (const AkosHeader *) _vm->findResourceData(MKTAG('A','K','H','D'), akos);
 	akof = (const AkosOffset *) _vm->findResourceData(MKTAG('A','K','O','F'), akos);
 	akci = _vm->findResourceData(MKTAG('A','K','C','I'), akos);
@@ -1183,6 +1189,68 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 	}
 }
 
+enum {
+	kAkos16CacheMaxSize = 1024 * 1024
+};
+
+void AkosRenderer::akos16ClearCache() {
+	for (Akos16Cache::iterator it = _akos16Cache.begin(); it != _akos16Cache.end(); ++it)
+		free(it->_value.pixels);
+	_akos16Cache.clear();
+	_akos16CacheSize = 0;
+}
+
+const byte *AkosRenderer::akos16GetDecodedImage() {
+	const uint32 offset = _srcptr - akcd;
+	const uint32 key = ((uint32)_costume << 20) ^ offset;
+	const uint32 size = _width * _height;
+
+	Akos16Cache::iterator it = _akos16Cache.find(key);
+	if (it != _akos16Cache.end()) {
+		Akos16CachedImage &image = it->_value;
+		if (image.costume == _costume && image.offset == offset && image.width == _width && image.height == _height) {
+			image.lastUse = ++_akos16CacheClock;
+			_akos16CacheHits++;
+			return image.pixels;
+		}
+		_akos16CacheSize -= image.width * image.height;
+		free(image.pixels);
+		_akos16Cache.erase(it);
+	}
+
+	_akos16CacheMisses++;
+	if (size > kAkos16CacheMaxSize / 4)
+		return NULL;
+
+	// Make room by dropping the least recently used images
+	while (_akos16CacheSize + size > kAkos16CacheMaxSize) {
+		Akos16Cache::iterator oldest = _akos16Cache.begin();
+		for (Akos16Cache::iterator i = _akos16Cache.begin(); i != _akos16Cache.end(); ++i) {
+			if (i->_value.lastUse < oldest->_value.lastUse)
+				oldest = i;
+		}
+		_akos16CacheSize -= oldest->_value.width * oldest->_value.height;
+		free(oldest->_value.pixels);
+		_akos16Cache.erase(oldest);
+	}
+
+	Akos16CachedImage image;
+	image.costume = _costume;
+	image.offset = offset;
+	image.width = _width;
+	image.height = _height;
+	image.lastUse = ++_akos16CacheClock;
+	image.pixels = (byte *)malloc(size);
+	assert(image.pixels);
+
+	akos16SetupBitReader(_srcptr);
+	akos16DecodeLine(image.pixels, size, 1);
+
+	_akos16Cache[key] = image;
+	_akos16CacheSize += size;
+	return image.pixels;
+}
+
 byte AkosRenderer::codec16(int xmoveCur, int ymoveCur) {
 	assert(_vm->_bytesPerPixel == 1);
 
@@ -1290,7 +1358,36 @@ byte AkosRenderer::codec16(int xmoveCur, int ymoveCur) {
 
 	byte *dst = (byte *)_out.getBasePtr(width_unk, height_unk);
 
-	akos16Decompress(dst, _out.pitch, _srcptr, cur_x, out_height, dir, numskip_before, numskip_after, transparency, clip.left, clip.top, _zbuf);
+	const byte *image = akos16GetDecodedImage();
+	if (!image) {
+		akos16Decompress(dst, _out.pitch, _srcptr, cur_x, out_height, dir, numskip_before, numskip_after, transparency, clip.left, clip.top, _zbuf);
+		return 0;
+	}
+
+	// Draw the visible part of the cached image, row by row, exactly as
+	// akos16Decompress() would have decoded it.
+	const byte maskbit = revBitMask(clip.left & 7);
+	byte *maskptr = _vm->getMaskBuffer(clip.left, clip.top, _zbuf);
+	const bool HE7Check = (_vm->_game.heversion == 70);
+	const byte *src = image + numskip_before;
+
+	if (dir < 0)
+		dst -= (cur_x - 1);
+
+	for (int32 y = 0; y < out_height; y++) {
+		if (dir < 0) {
+			for (int32 x = 0; x < cur_x; x++)
+				_akos16.buffer[cur_x - 1 - x] = src[x];
+		} else {
+			memcpy(_akos16.buffer, src, cur_x);
+		}
+		bompApplyMask(_akos16.buffer, maskptr, maskbit, cur_x, transparency);
+		bompApplyShadow(_shadow_mode, _shadow_table, _akos16.buffer, dst, cur_x, transparency, HE7Check);
+
+		src += _width;
+		dst += _out.pitch;
+		maskptr += _numStrips;
+	}
 	return 0;
 }
 
@@ -23,6 +23,8 @@
 #ifndef SCUMM_AKOS_H
 #define SCUMM_AKOS_H
 
+#include "common/hashmap.h"
+
 #include "scumm/base-costume.h"
 
 namespace Scumm {
@@ -85,6 +87,27 @@ protected:
 		byte buffer[336];
 	} _akos16;
 
+	/**
+	 * Fully decoded codec 16 limb images, keyed by costume number and limb
+	 * data offset (see akos16GetDecodedImage()). The bit-level codec 16
+	 * decoder is fairly expensive, and idle actors tend to show the same
+	 * few frames over and over again, so we keep the decoded pixels around
+	 * (up to kAkos16CacheMaxSize bytes in total).
+	 */
+	struct Akos16CachedImage {
+		int costume;
+		uint32 offset;
+		int width, height;
+		uint32 lastUse;
+		byte *pixels;
+	};
+	typedef Common::HashMap<uint32, Akos16CachedImage> Akos16Cache;
+	Akos16Cache _akos16Cache;
+	uint32 _akos16CacheSize;
+	uint32 _akos16CacheClock;
+	int _costume;
+	uint32 _akos16CacheHits, _akos16CacheMisses;
+
 public:
 	AkosRenderer(ScummEngine *scumm) : BaseCostumeRenderer(scumm) {
 		_useBompPalette = false;
@@ -98,7 +121,16 @@ public:
 		rgbs = 0;
 		xmap = 0;
 		_actorHitMode = false;
+		_akos16CacheSize = 0;
+		_akos16CacheClock = 0;
+		_costume = 0;
+		_akos16CacheHits = 0;
+		_akos16CacheMisses = 0;
 	}
+	~AkosRenderer();
+
+	uint32 getAkos16CacheHits() const { return _akos16CacheHits; }
+	uint32 getAkos16CacheMisses() const { return _akos16CacheMisses; }
 
 	bool _actorHitMode;
 	int16 _actorHitX, _actorHitY;
@@ -120,6 +152,8 @@ protected:
 	void akos16SkipData(int32 numskip);
 	void akos16DecodeLine(byte *buf, int32 numbytes, int32 dir);
 	void akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir, int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf);
+	const byte *akos16GetDecodedImage();
+	void akos16ClearCache();
 
 	void markRectAsDirty(Common::Rect rect);
 };
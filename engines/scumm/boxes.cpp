@@ -572,6 +572,27 @@ bool ScummEngine::checkXYInBoxBounds(int boxnum, int x, int y) {
 }
 
 BoxCoords ScummEngine::getBoxCoordinates(int boxnum) {
+	// Box 255 and out-of-range boxes are not cached; let calcBoxCoordinates
+	// deal with them.
+	if (boxnum < 0 || boxnum >= 255)
+		return calcBoxCoordinates(boxnum);
+
+	if (!_boxCoordsCache)
+		_boxCoordsCache = new BoxCoords[255];
+
+	const uint32 bit = 1 << (boxnum & 31);
+	if (!(_boxCoordsValid[boxnum >> 5] & bit)) {
+		_boxCoordsCache[boxnum] = calcBoxCoordinates(boxnum);
+		_boxCoordsValid[boxnum >> 5] |= bit;
+	}
+	return _boxCoordsCache[boxnum];
+}
+
+void ScummEngine::invalidateBoxCache() {
+	memset(_boxCoordsValid, 0, sizeof(_boxCoordsValid));
+}
+
+BoxCoords ScummEngine::calcBoxCoordinates(int boxnum) {
 	BoxCoords tmp, *box = &tmp;
 	Box *bp = getBoxBaseAddr(boxnum);
 	assert(bp);
@@ -1025,6 +1046,19 @@ void ScummEngine::createBoxMatrix() {
 	// The total number of boxes
 	num = getNumBoxes();
 
+	// If the box data is the same as for an earlier call in this room,
+	// reuse the box matrix computed back then.
+	const byte *boxData = getResourceAddress(rtMatrix, 2);
+	const uint32 boxDataSize = boxData ? _res->_types[rtMatrix][2]._size : 0;
+	for (i = 0; i < (int)_boxMatrixMemo.size(); i++) {
+		const BoxMatrixMemo &memo = _boxMatrixMemo[i];
+		if (memo.boxData.size() == boxDataSize && (!boxDataSize || !memcmp(memo.boxData.begin(), boxData, boxDataSize))) {
+			byte *matrix = _res->createResource(rtMatrix, 1, BOX_MATRIX_SIZE);
+			memcpy(matrix, memo.matrix.begin(), memo.matrix.size());
+			return;
+		}
+	}
+
 	const uint8 boxSize = (_game.version == 0) ? num : 64;
 
 	// calculate shortest paths
@@ -1063,6 +1097,18 @@ void ScummEngine::createBoxMatrix() {
 	}
 	addToMatrix(0xFF);
 
+	// Remember the result. The number of box configurations seen in a room
+	// is usually tiny, but cap it anyway.
+	if (_boxMatrixMemo.size() >= 8)
+		_boxMatrixMemo.remove_at(0);
+	BoxMatrixMemo memo;
+	if (boxDataSize) {
+		memo.boxData.resize(boxDataSize);
+		memcpy(memo.boxData.begin(), getResourceAddress(rtMatrix, 2), boxDataSize);
+	}
+	memo.matrix.resize(BOX_MATRIX_SIZE);
+	memcpy(memo.matrix.begin(), getResourceAddress(rtMatrix, 1), BOX_MATRIX_SIZE);
+	_boxMatrixMemo.push_back(memo);
 
 #if BOX_DEBUG
 	debug("Itinerary matrix:\n");
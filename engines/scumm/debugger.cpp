@@ -27,6 +27,7 @@
 #include "common/util.h"
 
 #include "scumm/actor.h"
+#include "scumm/akos.h"
 #include "scumm/boxes.h"
 #include "scumm/debugger.h"
 #include "scumm/imuse/imuse.h"
@@ -79,6 +80,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("scr",       WRAP_METHOD(ScummDebugger, Cmd_Script));
 	registerCmd("scripts",   WRAP_METHOD(ScummDebugger, Cmd_PrintScript));
 	registerCmd("importres", WRAP_METHOD(ScummDebugger, Cmd_ImportRes));
+	registerCmd("resstats",  WRAP_METHOD(ScummDebugger, Cmd_ResStats));
 
 	if (_vm->_game.id == GID_LOOM)
 		registerCmd("drafts",  WRAP_METHOD(ScummDebugger, Cmd_PrintDraft));
@@ -322,6 +324,23 @@ bool ScummDebugger::Cmd_ImportRes(int argc, const char** argv) {
 	return true;
 }
 
+bool ScummDebugger::Cmd_ResStats(int argc, const char **argv) {
+	ResourceManager *res = _vm->_res;
+	uint32 hits = res->getCacheHits();
+	uint32 misses = res->getCacheMisses();
+	uint32 total = hits + misses;
+
+	debugPrintf("Heap: %u of %u bytes allocated\n", res->getAllocatedSize(), res->getMaxHeapThreshold());
+	debugPrintf("Accesses: %u hits, %u misses (%d%% hit rate)\n", hits, misses, total ? (int)((uint64)hits * 100 / total) : 0);
+	debugPrintf("Expired: %u resources, %u bytes\n", res->getExpiredNum(), res->getExpiredSize());
+
+	if (_vm->_game.features & GF_NEW_COSTUMES) {
+		const AkosRenderer *akos = (const AkosRenderer *)_vm->_costumeRenderer;
+		debugPrintf("AKOS codec 16 image cache: %u hits, %u misses\n", akos->getAkos16CacheHits(), akos->getAkos16CacheMisses());
+	}
+	return true;
+}
+
 bool ScummDebugger::Cmd_PrintScript(int argc, const char **argv) {
 	int i;
 	ScriptSlot *ss = _vm->vm.slot;
@@ -2428,26 +2428,37 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 }
 
 void Gdi::decompressMaskImg(byte *dst, const byte *src, int height) const {
-	byte b, c;
+	const int pitch = _numStrips;
 
+	// A run length of zero stands for 256 rows, as the original used a
+	// byte counter which wrapped around.
 	while (height) {
-		b = *src++;
-
-		if (b & 0x80) {
-			b &= 0x7F;
-			c = *src++;
+		int run = *src++;
 
+		if (run & 0x80) {
+			run &= 0x7F;
+			if (run == 0)
+				run = 256;
+			if (run > height)
+				run = height;
+			height -= run;
+
+			const byte c = *src++;
 			do {
 				*dst = c;
-				dst += _numStrips;
-				--height;
-			} while (--b && height);
+				dst += pitch;
+			} while (--run);
 		} else {
+			if (run == 0)
+				run = 256;
+			if (run > height)
+				run = height;
+			height -= run;
+
 			do {
 				*dst = *src++;
-				dst += _numStrips;
-				--height;
-			} while (--b && height);
+				dst += pitch;
+			} while (--run);
 		}
 	}
 }
@@ -2501,26 +2512,42 @@ void GdiHE::decompressTMSK(byte *dst, const byte *tmsk, const byte *src, int hei
 }
 
 void Gdi::decompressMaskImgOr(byte *dst, const byte *src, int height) const {
-	byte b, c;
+	const int pitch = _numStrips;
 
+	// A run length of zero stands for 256 rows, as the original used a
+	// byte counter which wrapped around.
 	while (height) {
-		b = *src++;
+		int run = *src++;
 
-		if (b & 0x80) {
-			b &= 0x7F;
-			c = *src++;
-
-			do {
-				*dst |= c;
-				dst += _numStrips;
-				--height;
-			} while (--b && height);
+		if (run & 0x80) {
+			run &= 0x7F;
+			if (run == 0)
+				run = 256;
+			if (run > height)
+				run = height;
+			height -= run;
+
+			const byte c = *src++;
+			if (c) {
+				do {
+					*dst |= c;
+					dst += pitch;
+				} while (--run);
+			} else {
+				// OR-ing in an empty run leaves the mask unchanged.
+				dst += run * pitch;
+			}
 		} else {
+			if (run == 0)
+				run = 256;
+			if (run > height)
+				run = height;
+			height -= run;
+
 			do {
 				*dst |= *src++;
-				dst += _numStrips;
-				--height;
-			} while (--b && height);
+				dst += pitch;
+			} while (--run);
 		}
 	}
 }
@@ -3432,14 +3459,15 @@ void Gdi::drawStripComplex(byte *dst, int dstPitch, const byte *src, int height,
 	byte cl = 8;
 	byte bit;
 	byte incm, reps;
+	byte line[8];
 
+	// Each row of the strip is decoded into a line of color indices first,
+	// which is then written out in one go by writeRoomLine().
 	do {
-		int x = 8;
+		int x = 0;
 		do {
 			FILL_BITS;
-			if (!transpCheck || color != _transparentColor)
-				writeRoomColor(dst, color);
-			dst += _vm->_bytesPerPixel;
+			line[x] = color;
 
 		againPos:
 			if (!READ_BIT) {
@@ -3458,23 +3486,23 @@ void Gdi::drawStripComplex(byte *dst, int dstPitch, const byte *src, int height,
 					FILL_BITS;
 					reps = bits & 0xFF;
 					do {
-						if (!--x) {
-							x = 8;
-							dst += dstPitch - 8 * _vm->_bytesPerPixel;
+						if (++x == 8) {
+							x = 0;
+							writeRoomLine(dst, line, transpCheck);
+							dst += dstPitch;
 							if (!--height)
 								return;
 						}
-						if (!transpCheck || color != _transparentColor)
-							writeRoomColor(dst, color);
-						dst += _vm->_bytesPerPixel;
+						line[x] = color;
 					} while (--reps);
 					bits >>= 8;
 					bits |= (*src++) << (cl - 8);
 					goto againPos;
 				}
 			}
-		} while (--x);
-		dst += dstPitch - 8 * _vm->_bytesPerPixel;
+		} while (++x < 8);
+		writeRoomLine(dst, line, transpCheck);
+		dst += dstPitch;
 	} while (--height);
 }
 
@@ -3484,14 +3512,12 @@ void Gdi::drawStripBasicH(byte *dst, int dstPitch, const byte *src, int height,
 	byte cl = 8;
 	byte bit;
 	int8 inc = -1;
+	byte line[8];
 
 	do {
-		int x = 8;
-		do {
+		for (int x = 0; x < 8; ++x) {
 			FILL_BITS;
-			if (!transpCheck || color != _transparentColor)
-				writeRoomColor(dst, color);
-			dst += _vm->_bytesPerPixel;
+			line[x] = color;
 			if (!READ_BIT) {
 			} else if (!READ_BIT) {
 				FILL_BITS;
@@ -3505,8 +3531,9 @@ void Gdi::drawStripBasicH(byte *dst, int dstPitch, const byte *src, int height,
 				inc = -inc;
 				color += inc;
 			}
-		} while (--x);
-		dst += dstPitch - 8 * _vm->_bytesPerPixel;
+		}
+		writeRoomLine(dst, line, transpCheck);
+		dst += dstPitch;
 	} while (--height);
 }
 
@@ -3718,6 +3745,14 @@ void Gdi::unkDecode11(byte *dst, int dstPitch, const byte *src, int height) cons
 void GdiHE16bit::writeRoomColor(byte *dst, byte color) const {
 	WRITE_UINT16(dst, READ_LE_UINT16(_vm->_hePalettes + 2048 + color * 2));
 }
+
+
+void GdiHE16bit::writeRoomLine(byte *dst, const byte *line, bool transpCheck) const {
+	for (int x = 0; x < 8; ++x, dst += 2) {
+		if (!transpCheck || line[x] != _transparentColor)
+			writeRoomColor(dst, line[x]);
+	}
+}
 #endif
 
 void Gdi::writeRoomColor(byte *dst, byte color) const {
@@ -3728,6 +3763,46 @@ void Gdi::writeRoomColor(byte *dst, byte color) const {
 	*dst = _roomPalette[(color + _paletteMod) & 0xFF];
 }
 
+/**
+ * Returns a word with the uppermost bit of each byte set if the
+ * corresponding byte in the given word equals the given color.
+ */
+static inline uint32 matchColorBytes(uint32 word, uint32 color32) {
+	uint32 diff = word ^ color32;
+	return ~(((diff & 0x7F7F7F7F) + 0x7F7F7F7F) | diff) & 0x80808080;
+}
+
+void Gdi::writeRoomLine(byte *dst, const byte *line, bool transpCheck) const {
+	const byte *palette = _roomPalette;
+	const byte mod = _paletteMod;
+	byte colors[8];
+
+	uint32 transp = 0;
+	if (transpCheck) {
+		// Check all eight pixels for transparency at once, so that fully
+		// transparent and fully opaque lines avoid per-pixel branches.
+		const uint32 color32 = _transparentColor * 0x01010101;
+		uint32 lo, hi;
+		memcpy(&lo, line, 4);
+		memcpy(&hi, line + 4, 4);
+		transp = matchColorBytes(lo, color32) | (matchColorBytes(hi, color32) >> 1);
+		if (transp == 0xC0C0C0C0)
+			return;
+	}
+
+	for (int x = 0; x < 8; ++x)
+		colors[x] = palette[(line[x] + mod) & 0xFF];
+
+	if (!transp) {
+		memcpy(dst, colors, 8);
+	} else {
+		for (int x = 0; x < 8; ++x) {
+			if (line[x] != _transparentColor)
+				dst[x] = colors[x];
+		}
+	}
+}
+
 
 #pragma mark -
 #pragma mark --- Transition effects ---
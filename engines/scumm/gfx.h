@@ -236,6 +236,7 @@ protected:
 
 	void drawStripHE(byte *dst, int dstPitch, const byte *src, int width, int height, const bool transpCheck) const;
 	virtual void writeRoomColor(byte *dst, byte color) const;
+	virtual void writeRoomLine(byte *dst, const byte *line, bool transpCheck) const;
 
 	/* Mask decompressors */
 	void decompressMaskImgOr(byte *dst, const byte *src, int height) const;
@@ -450,6 +451,7 @@ public:
 class GdiHE16bit : public GdiHE {
 protected:
 	virtual void writeRoomColor(byte *dst, byte color) const;
+	virtual void writeRoomLine(byte *dst, const byte *line, bool transpCheck) const;
 public:
 	GdiHE16bit(ScummEngine *vm);
 };
@@ -193,6 +193,7 @@ void IMuseDigital::saveLoadEarly(Common::Serializer &s) {
 				error("IMuseDigital::saveOrLoad(): Can't handle %d bit samples", bits);
 
 			track->stream = Audio::makeQueuingAudioStream(freq, (track->mixerFlags & kFlagStereo) != 0);
+			track->queuedSize = 0;
 
 			_mixer->playStream(track->getType(), &track->mixChanHandle, track->stream, -1, track->getVol(), track->getPan());
 			_mixer->pauseHandle(track->mixChanHandle, true);
@@ -261,6 +262,14 @@ void IMuseDigital::callback() {
 
 				if (track->stream->endOfData()) {
 					feedSize *= 2;
+				} else if (track->volGroupId == IMUSE_VOLGRP_MUSIC) {
+					// Keep music one callback ahead of the mixer. The callback
+					// can be delayed while a script opcode holds _mutex (e.g.
+					// while a new sound is being opened), and without spare
+					// data in the queue that is audible as a stutter.
+					const uint32 playedSize = (uint64)_mixer->getSoundElapsedTime(track->mixChanHandle) * track->feedSize / 1000;
+					if ((int32)(track->queuedSize - playedSize) < feedSize)
+						feedSize *= 2;
 				}
 
 				if ((bits == 12) || (bits == 16)) {
@@ -339,6 +348,7 @@ void IMuseDigital::callback() {
 					if (_mixer->isReady()) {
 						track->stream->queueBuffer(tmpSndBufferPtr, curFeedSize, DisposeAfterUse::YES, makeMixerFlags(track));
 						track->regionOffset += curFeedSize;
+						track->queuedSize += curFeedSize;
 					} else
 						free(tmpSndBufferPtr);
 
@@ -69,6 +69,7 @@ struct Track {
 	int32 soundType;	// type of sound data (IMUSE_BUNDLE, IMUSE_RESOURCE)
 	int32 feedSize;		// size of sound data needed to be filled at each callback iteration
 	int32 dataMod12Bit;	// value used between all callback to align 12 bit source of data
+	uint32 queuedSize;	// size of sound data queued to the stream since it was created
 	int32 mixerFlags;	// flags for sound mixer's channel (kFlagStereo, kFlag16Bits, kFlagUnsigned)
 
 	ImuseDigiSndMgr::SoundDesc *soundDesc;	// sound handle used by iMuse sound manager
@@ -100,6 +101,7 @@ struct Track {
 		soundType = 0;
 		feedSize = 0;
 		dataMod12Bit = 0;
+		queuedSize = 0;
 		mixerFlags = 0;
 		soundDesc = nullptr;
 		stream = nullptr;
@@ -20,6 +20,8 @@
  *
  */
 
+#include "common/algorithm.h"
+#include "common/profiler.h"
 #include "common/str.h"
 #ifndef MACOSX
 #include "common/config-manager.h"
@@ -540,6 +542,10 @@ void ResourceManager::allocResTypeData(ResType type, uint32 tag, int num, ResTyp
 
 	// If there was data in there, let's clear it out completely. This is important
 	// in case we are restarting the game.
+	for (uint i = _expiryList.size(); i-- > 0; ) {
+		if (_expiryList[i].type == type)
+			removeFromExpiryList(type, _expiryList[i].idx);
+	}
 	_types[type].clear();
 	_types[type].resize(num);
 
@@ -619,6 +625,7 @@ void ScummEngine::ensureResourceLoaded(ResType type, ResId idx) {
 }
 
 int ScummEngine::loadResource(ResType type, ResId idx) {
+	PROFILE_ZONE("ScummEngine::loadResource");
 	int roomNr;
 	uint32 fileOffs;
 	uint32 size, tag;
@@ -736,8 +743,10 @@ byte *ScummEngine::getResourceAddress(ResType type, ResId idx) {
 		return NULL;
 
 	// If the resource is missing, but loadable from the game data files, try to do so.
-	if (!_res->_types[type][idx]._address && _res->_types[type]._mode != kDynamicResTypeMode) {
-		ensureResourceLoaded(type, idx);
+	if (_res->_types[type]._mode != kDynamicResTypeMode) {
+		_res->countAccess(_res->_types[type][idx]._address != NULL);
+		if (!_res->_types[type][idx]._address)
+			ensureResourceLoaded(type, idx);
 	}
 
 	ptr = (byte *)_res->_types[type][idx]._address;
@@ -777,13 +786,14 @@ void ResourceManager::increaseExpireCounter() {
 }
 
 void ResourceManager::increaseResourceCounters() {
-	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
-		ResId idx = _types[type].size();
-		while (idx-- > 0) {
-			byte counter = _types[type][idx].getResourceCounter();
-			if (counter && counter < RF_USAGE_MAX) {
-				setResourceCounter(type, idx, counter + 1);
-			}
+	// Only the counters of expirable resources are ever looked at, and
+	// loading a resource resets its counter, so it is enough to age the
+	// resources which are currently loaded.
+	for (uint i = 0; i < _expiryList.size(); ++i) {
+		Resource &res = _types[_expiryList[i].type][_expiryList[i].idx];
+		byte counter = res.getResourceCounter();
+		if (counter && counter < RF_USAGE_MAX) {
+			res.setResourceCounter(counter + 1);
 		}
 	}
 }
@@ -834,6 +844,10 @@ byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 	_types[type][idx]._address = ptr;
 	_types[type][idx]._size = size;
 	setResourceCounter(type, idx, 1);
+	if (type == rtMatrix && idx == 2)
+		_vm->invalidateBoxCache();
+	if (_types[type]._mode != kDynamicResTypeMode)
+		addToExpiryList(type, idx);
 	return ptr;
 }
 
@@ -842,6 +856,7 @@ ResourceManager::Resource::Resource() {
 	_size = 0;
 	_flags = 0;
 	_status = 0;
+	_expiryPos = -1;
 	_roomno = 0;
 	_roomoffs = 0;
 }
@@ -872,6 +887,10 @@ ResourceManager::ResourceManager(ScummEngine *vm) : _vm(vm) {
 	_maxHeapThreshold = 0;
 	_minHeapThreshold = 0;
 	_expireCounter = 0;
+	_cacheHits = 0;
+	_cacheMisses = 0;
+	_expiredNum = 0;
+	_expiredSize = 0;
 }
 
 ResourceManager::~ResourceManager() {
@@ -898,7 +917,10 @@ void ResourceManager::nukeResource(ResType type, ResId idx) {
 	if (ptr != NULL) {
 		debugC(DEBUG_RESOURCE, "nukeResource(%s,%d)", nameOfResType(type), idx);
 		_allocatedSize -= _types[type][idx]._size;
+		removeFromExpiryList(type, idx);
 		_types[type][idx].nuke();
+		if (type == rtMatrix && idx == 2)
+			_vm->invalidateBoxCache();
 	}
 }
 
@@ -1032,10 +1054,57 @@ void ResourceManager::Resource::setOnHeap() {
 	_status &= ~RF_OFFHEAP;
 }
 
+void ResourceManager::addToExpiryList(ResType type, ResId idx) {
+	Resource &res = _types[type][idx];
+	if (res._expiryPos >= 0)
+		return;
+
+	LoadedResource entry;
+	entry.type = type;
+	entry.idx = idx;
+	res._expiryPos = _expiryList.size();
+	_expiryList.push_back(entry);
+}
+
+void ResourceManager::removeFromExpiryList(ResType type, ResId idx) {
+	Resource &res = _types[type][idx];
+	if (res._expiryPos < 0)
+		return;
+
+	// Move the last entry into the freed slot to keep the list compact.
+	const LoadedResource &last = _expiryList.back();
+	_types[last.type][last.idx]._expiryPos = res._expiryPos;
+	_expiryList[res._expiryPos] = last;
+	_expiryList.pop_back();
+	res._expiryPos = -1;
+}
+
+namespace {
+
+struct ExpiryCandidate {
+	ResType type;
+	ResId idx;
+	byte counter;
+};
+
+/**
+ * Orders expiry candidates oldest first. Ties are broken the same way the
+ * old exhaustive search did, which preferred the highest resource type and,
+ * within a type, the lowest index.
+ */
+struct ExpiryCandidateLess {
+	bool operator()(const ExpiryCandidate &a, const ExpiryCandidate &b) const {
+		if (a.counter != b.counter)
+			return a.counter > b.counter;
+		if (a.type != b.type)
+			return a.type > b.type;
+		return a.idx < b.idx;
+	}
+};
+
+} // End of anonymous namespace
+
 void ResourceManager::expireResources(uint32 size) {
-	byte best_counter;
-	ResType best_type;
-	int best_res = 0;
 	uint32 oldAllocatedSize;
 
 	if (_expireCounter != 0xFF) {
@@ -1048,31 +1117,33 @@ void ResourceManager::expireResources(uint32 size) {
 
 	oldAllocatedSize = _allocatedSize;
 
-	do {
-		best_type = rtInvalid;
-		best_counter = 2;
-
-		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
-			if (_types[type]._mode != kDynamicResTypeMode) {
-				// Resources of this type can be reloaded from the data files,
-				// so we can potentially unload them to free memory.
-				ResId idx = _types[type].size();
-				while (idx-- > 0) {
-					Resource &tmp = _types[type][idx];
-					byte counter = tmp.getResourceCounter();
-					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
-						best_counter = counter;
-						best_type = type;
-						best_res = idx;
-					}
-				}
-			}
+	// Nuking a resource does not affect whether any other resource is in
+	// use, so we can collect all candidates in a single pass and then
+	// nuke them oldest first, until enough memory has been freed.
+	Common::Array<ExpiryCandidate> candidates;
+	for (uint i = 0; i < _expiryList.size(); ++i) {
+		ResType type = _expiryList[i].type;
+		ResId idx = _expiryList[i].idx;
+		const Resource &tmp = _types[type][idx];
+		byte counter = tmp.getResourceCounter();
+		if (!tmp.isLocked() && counter >= 2 && !tmp.isOffHeap() && !_vm->isResourceInUse(type, idx)) {
+			ExpiryCandidate candidate;
+			candidate.type = type;
+			candidate.idx = idx;
+			candidate.counter = counter;
+			candidates.push_back(candidate);
 		}
+	}
+
+	Common::sort(candidates.begin(), candidates.end(), ExpiryCandidateLess());
 
-		if (!best_type)
+	for (uint i = 0; i < candidates.size(); ++i) {
+		_expiredNum++;
+		_expiredSize += _types[candidates[i].type][candidates[i].idx]._size;
+		nukeResource(candidates[i].type, candidates[i].idx);
+		if (size + _allocatedSize <= _minHeapThreshold)
 			break;
-		nukeResource(best_type, best_res);
-	} while (size + _allocatedSize > _minHeapThreshold);
+	}
 
 	increaseResourceCounters();
 
@@ -1133,7 +1204,8 @@ void ResourceManager::resourceStats() {
 		}
 	}
 
-	debug(1, "Total allocated size=%d, locked=%d(%d)", _allocatedSize, lockedSize, lockedNum);
+	debug(1, "Total allocated size=%u, locked=%u(%u)", _allocatedSize, lockedSize, lockedNum);
+	debug(1, "Resource hits=%u, misses=%u, expired=%u(%u)", _cacheHits, _cacheMisses, _expiredSize, _expiredNum);
 }
 
 void ScummEngine_v5::readMAXS(int blockSize) {
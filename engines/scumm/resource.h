@@ -110,6 +110,14 @@ public:
 		 */
 		byte _status;
 
+		/**
+		 * Position of this resource in the resource manager's list of
+		 * expirable loaded resources, or -1 if it is not on that list.
+		 */
+		int _expiryPos;
+
+		friend class ResourceManager;
+
 	public:
 		/**
 		 * The id of the room (resp. the disk) the resource is contained in.
@@ -176,11 +184,29 @@ protected:
 	uint32 _maxHeapThreshold, _minHeapThreshold;
 	byte _expireCounter;
 
+	struct LoadedResource {
+		ResType type;
+		ResId idx;
+	};
+
+	/**
+	 * All currently loaded resources which may be expired, i.e. those
+	 * whose type can be reloaded from the game data files. Expiring
+	 * resources and aging their counters only walks this list, instead
+	 * of every resource slot of every type.
+	 */
+	Common::Array<LoadedResource> _expiryList;
+
+	uint32 _cacheHits, _cacheMisses;
+	uint32 _expiredNum, _expiredSize;
+
 public:
 	ResourceManager(ScummEngine *vm);
 	~ResourceManager();
 
 	void setHeapThreshold(int min, int max);
+	uint32 getMaxHeapThreshold() const { return _maxHeapThreshold; }
+	uint32 getAllocatedSize() const { return _allocatedSize; }
 
 	void allocResTypeData(ResType type, uint32 tag, int num, ResTypeMode mode);
 	void freeResources();
@@ -223,12 +249,30 @@ public:
 	 */
 	void increaseResourceCounters();
 
+	/**
+	 * Count an access to a resource which can be loaded from the game
+	 * data files, depending on whether it was already in memory.
+	 */
+	void countAccess(bool hit) {
+		if (hit)
+			_cacheHits++;
+		else
+			_cacheMisses++;
+	}
+
+	uint32 getCacheHits() const { return _cacheHits; }
+	uint32 getCacheMisses() const { return _cacheMisses; }
+	uint32 getExpiredNum() const { return _expiredNum; }
+	uint32 getExpiredSize() const { return _expiredSize; }
+
 	void resourceStats();
 
 //protected:
 	bool validateResource(const char *str, ResType type, ResId idx) const;
 protected:
 	void expireResources(uint32 size);
+	void addToExpiryList(ResType type, ResId idx);
+	void removeFromExpiryList(ResType type, ResId idx);
 };
 
 } // End of namespace Scumm
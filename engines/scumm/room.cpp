@@ -478,6 +478,7 @@ void ScummEngine::resetRoomSubBlocks() {
 	// Load box data
 	//
 	memset(_extraBoxFlags, 0, sizeof(_extraBoxFlags));
+	_boxMatrixMemo.clear();
 
 	_res->nukeResource(rtMatrix, 1);
 	_res->nukeResource(rtMatrix, 2);
@@ -737,6 +738,7 @@ void ScummEngine_v3old::resetRoomSubBlocks() {
 	//
 	// Load box data
 	//
+	_boxMatrixMemo.clear();
 	_res->nukeResource(rtMatrix, 1);
 	_res->nukeResource(rtMatrix, 2);
 
@@ -21,6 +21,7 @@
  */
 
 #include "common/config-manager.h"
+#include "common/debug-channels.h"
 #include "common/util.h"
 #include "common/system.h"
 
@@ -442,23 +443,24 @@ void ScummEngine::resetScriptPointer() {
 }
 
 /**
- * This method checks whether the resource that contains the active script
- * moved, and if so, updates the script pointer accordingly.
+ * This method is called by refreshScriptPointer() once the resource that
+ * contains the active script moved, and updates the script pointer accordingly.
  *
  * The script resource may have moved because it might have been garbage
  * collected by ResourceManager::expireResources.
  */
-void ScummEngine::refreshScriptPointer() {
-	if (*_lastCodePtr != _scriptOrgPointer) {
-		long oldoffs = _scriptPointer - _scriptOrgPointer;
-		getScriptBaseAddress();
-		_scriptPointer = _scriptOrgPointer + oldoffs;
-	}
+void ScummEngine::rebaseScriptPointer() {
+	long oldoffs = _scriptPointer - _scriptOrgPointer;
+	getScriptBaseAddress();
+	_scriptPointer = _scriptOrgPointer + oldoffs;
 }
 
 /** Execute a script - Read opcode, and execute it from the table */
 void ScummEngine::executeScript() {
 	int c;
+	// Tracing is looked up once per call rather than for every opcode.
+	// Like debugC(), debug level 11 enables it for all channels.
+	const bool traceOpcodes = gDebugLevel == 11 || DebugMan.isDebugChannelEnabled(DEBUG_OPCODES);
 	while (_currentScript != 0xFF) {
 
 		if (_showStack == 1) {
@@ -471,11 +473,12 @@ void ScummEngine::executeScript() {
 		_opcode = fetchScriptByte();
 		if (_game.version > 2) // V0-V2 games didn't use the didexec flag
 			vm.slot[_currentScript].didexec = true;
-		debugC(DEBUG_OPCODES, "Script %d, offset 0x%x: [%X] %s()",
-				vm.slot[_currentScript].number,
-				(uint)(_scriptPointer - _scriptOrgPointer),
-				_opcode,
-				getOpcodeDesc(_opcode));
+		if (traceOpcodes)
+			debugC(DEBUG_OPCODES, "Script %d, offset 0x%x: [%X] %s()",
+					vm.slot[_currentScript].number,
+					(uint)(_scriptPointer - _scriptOrgPointer),
+					_opcode,
+					getOpcodeDesc(_opcode));
 		if (_hexdumpScripts == true) {
 			for (c = -1; c < 15; c++) {
 				debugN(" %02x", *(_scriptPointer + c));
@@ -504,11 +507,6 @@ const char *ScummEngine::getOpcodeDesc(byte i) {
 #endif
 }
 
-byte ScummEngine::fetchScriptByte() {
-	refreshScriptPointer();
-	return *_scriptPointer++;
-}
-
 uint ScummEngine::fetchScriptWord() {
 	refreshScriptPointer();
 	uint a = READ_LE_UINT16(_scriptPointer);
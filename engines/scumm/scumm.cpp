@@ -23,6 +23,7 @@
 #include "common/config-manager.h"
 #include "common/debug-channels.h"
 #include "common/md5.h"
+#include "common/profiler.h"
 #include "common/events.h"
 #include "common/system.h"
 #include "common/translation.h"
@@ -34,6 +35,7 @@
 #include "graphics/cursorman.h"
 
 #include "scumm/akos.h"
+#include "scumm/boxes.h"
 #include "scumm/charset.h"
 #include "scumm/costume.h"
 #include "scumm/debugger.h"
@@ -311,6 +313,8 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	_defaultTalkDelay = 0;
 	_saveSound = 0;
 	memset(_extraBoxFlags, 0, sizeof(_extraBoxFlags));
+	_boxCoordsCache = NULL;
+	memset(_boxCoordsValid, 0, sizeof(_boxCoordsValid));
 	memset(_scaleSlots, 0, sizeof(_scaleSlots));
 	_charset = NULL;
 	_charsetColor = 0;
@@ -621,6 +625,8 @@ ScummEngine::~ScummEngine() {
 	}
 
 	delete[] _sortedActors;
+
+	delete[] _boxCoordsCache;
 #ifdef SCUMMVMKOR
 	if (_koreanMode) unloadKoreanFiles();
 	if (_2byteFontPtr && !_useMultiFont)
@@ -1482,6 +1488,19 @@ void ScummEngine::setupScumm() {
 		maxHeapThreshold = 550000;
 	}
 
+	// Allow overriding the heap budget (in KB), e.g. to keep more rooms and
+	// costumes cached on machines with plenty of memory. It has to stay above
+	// the minimum heap threshold below.
+	if (ConfMan.hasKey("heap_budget")) {
+		const int minHeapBudget = 400;
+		const int maxHeapBudget = 1024 * 1024;
+		const int heapBudget = ConfMan.getInt("heap_budget");
+		const int clippedHeapBudget = CLIP(heapBudget, minHeapBudget, maxHeapBudget);
+		if (clippedHeapBudget != heapBudget)
+			warning("heap_budget of %d KB is out of range, using %d KB", heapBudget, clippedHeapBudget);
+		maxHeapThreshold = clippedHeapBudget * 1024;
+	}
+
 	_res->setHeapThreshold(400000, maxHeapThreshold);
 
 	free(_compositeBuf);
@@ -2264,6 +2283,8 @@ void ScummEngine_v0::scummLoop(int delta) {
 }
 
 void ScummEngine::scummLoop(int delta) {
+	PROFILE_ZONE("ScummEngine::scummLoop");
+
 	if (_game.version >= 3) {
 		VAR(VAR_TMR_1) += delta;
 		VAR(VAR_TMR_2) += delta;
@@ -2287,21 +2308,6 @@ void ScummEngine::scummLoop(int delta) {
 	if (_talkDelay < 0)
 		_talkDelay = 0;
 
-#ifdef SCUMMVMKOR
-	for(int numb = 0; numb < MAX_KOR; numb++) {
-		if (_strKSet1[numb].delay != -1) { // kor
-			_strKSet1[numb].delay -= delta;
-			if (_strKSet1[numb].delay < 0)
-				_strKSet1[numb].delay = 0;
-		}
-		if (_strKDesc[numb].delay != -1) { // kor
-			_strKDesc[numb].delay -= 5;
-			if (_strKDesc[numb].delay < 0)
-				_strKDesc[numb].delay = 0;
-		}
-	}
-#endif
-
 	// Record the current ego actor before any scripts (including input scripts)
 	// get a chance to run.
 	int oldEgo = 0;
@@ -699,8 +699,19 @@ protected:
 	void resetScriptPointer();
 	int getVerbEntrypoint(int obj, int entry);
 
-	void refreshScriptPointer();
-	byte fetchScriptByte();
+	/**
+	 * Check whether the resource holding the active script moved, and if
+	 * so, rebase the script pointer. Inline since it runs for every fetch.
+	 */
+	void refreshScriptPointer() {
+		if (*_lastCodePtr != _scriptOrgPointer)
+			rebaseScriptPointer();
+	}
+	void rebaseScriptPointer();
+	byte fetchScriptByte() {
+		refreshScriptPointer();
+		return *_scriptPointer++;
+	}
 	virtual uint fetchScriptWord();
 	virtual int fetchScriptWordSigned();
 	uint fetchScriptDWord();
@@ -1151,6 +1162,7 @@ public:
 	bool checkXYInBoxBounds(int box, int x, int y);
 
 	BoxCoords getBoxCoordinates(int boxnum);
+	void invalidateBoxCache();
 
 	byte getMaskFromBox(int box);
 	Box *getBoxBaseAddr(int box);
@@ -1172,6 +1184,29 @@ protected:
 	void setBoxScaleSlot(int box, int slot);
 	void convertScaleTableToScaleSlot(int slot);
 
+	BoxCoords calcBoxCoordinates(int boxnum);
+
+	/**
+	 * Decoded coordinates of the walkboxes of the current box data, indexed
+	 * by box number. _boxCoordsValid has one bit per box telling whether
+	 * the entry is valid; all bits are cleared whenever the box data is
+	 * (re)created or nuked.
+	 */
+	BoxCoords *_boxCoordsCache;
+	uint32 _boxCoordsValid[8];
+
+	/**
+	 * Box matrices computed by createBoxMatrix for the current room, along
+	 * with the box data they were computed from. Scripts often switch box
+	 * flags back and forth (e.g. for doors) and then rebuild the matrix,
+	 * so this saves recomputing the itineraries each time.
+	 */
+	struct BoxMatrixMemo {
+		Common::Array<byte> boxData;
+		Common::Array<byte> matrix;
+	};
+	Common::Array<BoxMatrixMemo> _boxMatrixMemo;
+
 	void calcItineraryMatrix(byte *itineraryMatrix, int num);
 	void createBoxMatrix();
 	virtual bool areBoxesNeighbors(int i, int j);
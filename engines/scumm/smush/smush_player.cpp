@@ -22,6 +22,7 @@
 
 #include "common/config-manager.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/util.h"
 
@@ -234,6 +235,11 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm) {
 	_base = NULL;
 	_frameBuffer = NULL;
 	_specialBuffer = NULL;
+	_frameData = NULL;
+	_frameDataCapacity = 0;
+	_frameDataOffset = -1;
+	_chunkBuffer = NULL;
+	_chunkBufferCapacity = 0;
 
 	_seekPos = -1;
 
@@ -314,6 +320,15 @@ void SmushPlayer::release() {
 	free(_frameBuffer);
 	_frameBuffer = NULL;
 
+	free(_frameData);
+	_frameData = NULL;
+	_frameDataCapacity = 0;
+	_frameDataOffset = -1;
+
+	free(_chunkBuffer);
+	_chunkBuffer = NULL;
+	_chunkBufferCapacity = 0;
+
 	_IACTstream = NULL;
 
 	_vm->_smushActive = false;
@@ -829,7 +844,7 @@ void SmushPlayer::handleZlibFrameObject(int32 subSize, Common::SeekableReadStrea
 	b.read(chunkBuffer, chunkSize);
 
 	unsigned long decompressedSize = READ_BE_UINT32(chunkBuffer);
-	byte *fobjBuffer = (byte *)malloc(decompressedSize);
+	byte *fobjBuffer = getChunkBuffer(decompressedSize);
 	if (!Common::uncompress(fobjBuffer, &decompressedSize, chunkBuffer + 4, chunkSize - 4))
 		error("SmushPlayer::handleZlibFrameObject() Zlib uncompress error");
 	free(chunkBuffer);
@@ -842,8 +857,6 @@ void SmushPlayer::handleZlibFrameObject(int32 subSize, Common::SeekableReadStrea
 	int height = READ_LE_UINT16(ptr); ptr += 2;
 
 	decodeFrameObject(codec, fobjBuffer + 14, left, top, width, height);
-
-	free(fobjBuffer);
 }
 #endif
 
@@ -864,13 +877,20 @@ void SmushPlayer::handleFrameObject(int32 subSize, Common::SeekableReadStream &b
 	b.readUint16LE();
 
 	int32 chunk_size = subSize - 14;
-	byte *chunk_buffer = (byte *)malloc(chunk_size);
-	assert(chunk_buffer);
+	byte *chunk_buffer = getChunkBuffer(chunk_size);
 	b.read(chunk_buffer, chunk_size);
 
 	decodeFrameObject(codec, chunk_buffer, left, top, width, height);
+}
 
-	free(chunk_buffer);
+byte *SmushPlayer::getChunkBuffer(uint32 size) {
+	if (size > _chunkBufferCapacity) {
+		free(_chunkBuffer);
+		_chunkBuffer = (byte *)malloc(size);
+		assert(_chunkBuffer);
+		_chunkBufferCapacity = size;
+	}
+	return _chunkBuffer;
 }
 
 void SmushPlayer::handleFrame(int32 frameSize, Common::SeekableReadStream &b) {
@@ -1009,9 +1029,55 @@ SmushFont *SmushPlayer::getFont(int font) {
 	return _sf[font];
 }
 
+bool SmushPlayer::frameFitsBuffer(int32 frameSize) const {
+	// handleFrame() may seek past the end of the frame when a subchunk is
+	// larger than announced or its pad byte belongs to the next chunk. Only
+	// frames which stay inside the buffer are played from the read-ahead
+	// copy, anything else is parsed from the file as before.
+	int32 offset = 0;
+	while (offset < frameSize) {
+		if (offset + 8 > frameSize)
+			return false;
+		const int32 subSize = READ_BE_UINT32(_frameData + offset + 4);
+		if (subSize < 0 || subSize > frameSize - offset - 8 - (subSize & 1))
+			return false;
+		offset += 8 + subSize + (subSize & 1);
+	}
+	return true;
+}
+
+void SmushPlayer::readAheadFrame() {
+	if (!_base || _seekPos >= 0 || _endOfFile)
+		return;
+
+	const int32 pos = _base->pos();
+	if (pos + 8 >= (int32)_baseSize || _frameDataOffset == pos + 8)
+		return;
+
+	const uint32 subType = _base->readUint32BE();
+	const int32 subSize = _base->readUint32BE();
+
+	if (subType == MKTAG('F','R','M','E') && subSize > 0 && pos + 8 + subSize <= (int32)_baseSize) {
+		if ((uint32)subSize > _frameDataCapacity) {
+			free(_frameData);
+			_frameData = (byte *)malloc(subSize);
+			assert(_frameData);
+			_frameDataCapacity = subSize;
+		}
+		if (_base->read(_frameData, subSize) == (uint32)subSize && frameFitsBuffer(subSize))
+			_frameDataOffset = pos + 8;
+		else
+			_frameDataOffset = -1;
+	}
+
+	_base->seek(pos, SEEK_SET);
+}
+
 void SmushPlayer::parseNextFrame() {
 
 	if (_seekPos >= 0) {
+		_frameDataOffset = -1;
+
 		if (_smixer)
 			_smixer->stop();
 
@@ -1074,7 +1140,14 @@ void SmushPlayer::parseNextFrame() {
 		handleAnimHeader(subSize, *_base);
 		break;
 	case MKTAG('F','R','M','E'):
-		handleFrame(subSize, *_base);
+		if (_frameDataOffset == subOffset) {
+			// The frame was read ahead while waiting for it to be due
+			Common::MemoryReadStream frame(_frameData, subSize);
+			_frameDataOffset = -1;
+			handleFrame(subSize, frame);
+		} else {
+			handleFrame(subSize, *_base);
+		}
 		break;
 	default:
 		error("Unknown Chunk found at %x: %s, %d", subOffset, tag2str(subType), subSize);
@@ -1247,6 +1320,10 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 			else
 				skipFrame = false;
 			timerCallback();
+		} else {
+			// The next frame is not due yet; use the spare time to read
+			// it from disk, so that it can be decoded right away.
+			readAheadFrame();
 		}
 
 		_vm->scummLoop_handleSound();
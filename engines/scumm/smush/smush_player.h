@@ -56,6 +56,17 @@ private:
 	byte *_frameBuffer;
 	byte *_specialBuffer;
 
+	// Raw data of the next FRME chunk, read ahead while waiting for it to
+	// be due. _frameDataOffset is the file offset of the chunk contents, or
+	// -1 if nothing has been read ahead.
+	byte *_frameData;
+	uint32 _frameDataCapacity;
+	int32 _frameDataOffset;
+
+	// Scratch buffer reused for frame objects
+	byte *_chunkBuffer;
+	uint32 _chunkBufferCapacity;
+
 	Common::String _seekFile;
 	uint32 _startFrame;
 	uint32 _startTime;
@@ -119,6 +130,9 @@ private:
 	void setupAnim(const char *file);
 	void updateScreen();
 	void tryCmpFile(const char *filename);
+	void readAheadFrame();
+	bool frameFitsBuffer(int32 frameSize) const;
+	byte *getChunkBuffer(uint32 size);
 
 	bool readString(const char *file);
 	void decodeFrameObject(int codec, const uint8 *src, int left, int top, int width, int height);
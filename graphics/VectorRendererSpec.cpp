@@ -501,6 +501,35 @@ void colorFillClip(PixelType *first, PixelType *last, PixelType color, int realX
 	}
 }
 
+/**
+ * Fills several pixels in a row with two alternating colors, as used by
+ * the dithered gradient rows.
+ *
+ * @param first Pointer to the first pixel to fill.
+ * @param last Pointer to the last pixel to fill.
+ * @param even Color of the pixels in even columns.
+ * @param odd Color of the pixels in odd columns.
+ * @param x Column of the first pixel.
+ */
+template<typename PixelType>
+void ditherFill(PixelType *first, PixelType *last, PixelType even, PixelType odd, int x) {
+	if (even == odd) {
+		colorFill<PixelType>(first, last, even);
+		return;
+	}
+
+	if (first != last && (x & 1))
+		*first++ = odd;
+
+	while (last - first >= 2) {
+		first[0] = even;
+		first[1] = odd;
+		first += 2;
+	}
+
+	if (first != last)
+		*first = even;
+}
 
 VectorRenderer *createRenderer(int mode) {
 #ifdef DISABLE_FANCY_THEMES
@@ -630,16 +659,11 @@ gradientFill(PixelType *ptr, int width, int x, int y) {
 	} else if (grad == 3 && ox) {
 		colorFill<PixelType>(ptr, ptr + width, _gradCache[curGrad + 1]);
 	} else {
-		for (int j = x; j < x + width; j++, ptr++) {
-			bool oy = ((j & 1) == 1);
+		// Every row of the pattern only alternates between two colors
+		const PixelType even = ((grad == 2 || grad == 3) && ox) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
+		const PixelType odd = (ox || grad == 3) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
 
-			if ((ox && oy) ||
-				((grad == 2 || grad == 3) && ox && !oy) ||
-				(grad == 3 && oy))
-				*ptr = _gradCache[curGrad + 1];
-			else
-				*ptr = _gradCache[curGrad];
-		}
+		ditherFill<PixelType>(ptr, ptr + width, even, odd, x);
 	}
 }
 
@@ -672,17 +696,14 @@ gradientFillClip(PixelType *ptr, int width, int x, int y, int realX, int realY)
 	} else if (grad == 3 && ox) {
 		colorFill<PixelType>(ptr, ptr + width, _gradCache[curGrad + 1]);
 	} else {
-		for (int j = x; j < x + width; j++, ptr++) {
-			if (realX + j - x < _clippingArea.left || realX + j - x >= _clippingArea.right) continue;
-			bool oy = ((j & 1) == 1);
-
-			if ((ox && oy) ||
-				((grad == 2 || grad == 3) && ox && !oy) ||
-				(grad == 3 && oy))
-				*ptr = _gradCache[curGrad + 1];
-			else
-				*ptr = _gradCache[curGrad];
-		}
+		// Every row of the pattern only alternates between two colors
+		const PixelType even = ((grad == 2 || grad == 3) && ox) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
+		const PixelType odd = (ox || grad == 3) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
+
+		const int first = MAX(0, _clippingArea.left - realX);
+		const int last = MIN(width, _clippingArea.right - realX);
+		if (first < last)
+			ditherFill<PixelType>(ptr + first, ptr + last, even, odd, x + first);
 	}
 }
 
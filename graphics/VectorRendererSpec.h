@@ -289,8 +289,15 @@ protected:
 	 * @param alpha Alpha intensity of the pixel (0-255)
 	 */
 	inline void blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha) {
-		while (first != last)
-			blendPixelPtr(first++, color, alpha);
+		if (alpha == 0xff) {
+			// Opaque spans don't need to read the destination at all
+			color |= _alphaMask;
+			while (first != last)
+				*first++ = color;
+		} else if (alpha != 0) {
+			while (first != last)
+				blendPixelPtr(first++, color, alpha);
+		}
 	}
 
 	inline void blendFillClip(PixelType *first, PixelType *last, PixelType color, uint8 alpha, int realX, int realY) {
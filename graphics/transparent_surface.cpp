@@ -57,6 +57,37 @@ static const int kGIndex = 1;
 static const int kRIndex = 0;
 #endif
 
+// Read as a native uint32, a pixel has A in bits 0-7, B in bits 8-15, G in
+// bits 16-23 and R in bits 24-31 on both little and big endian systems. The
+// blitters below use this to process two channels with a single multiply:
+// one pair is A and G (masked with kLowChannels), the other B and R (shifted
+// down by 8 bits first). Every intermediate product of a channel with an
+// 8 bit factor fits into the 16 bits of its lane, thus the results are
+// identical to blending each channel on its own.
+static const uint32 kLowChannels = 0x00FF00FF;
+static const uint32 kAlphaMask = 0x000000FF;
+static const uint32 kGreenMask = 0x00FF0000;
+
+/**
+ * Blends the source pixel over the destination pixel with the given alpha
+ * value, the result is fully opaque.
+ */
+static inline uint32 blendPixel(uint32 in, uint32 out, uint32 alpha) {
+	const uint32 invAlpha = 255 - alpha;
+	const uint32 br = ((((in >> 8) & kLowChannels) * alpha + ((out >> 8) & kLowChannels) * invAlpha) >> 8) & kLowChannels;
+	const uint32 ag = (((in & kLowChannels) * alpha + (out & kLowChannels) * invAlpha) >> 8) & kGreenMask;
+	return (br << 8) | ag | kAlphaMask;
+}
+
+/**
+ * Saturates each 16 bit lane of value to 255. Every lane must be at most
+ * 510.
+ */
+static inline uint32 saturateLanes(uint32 value) {
+	const uint32 overflow = (value >> 8) & 0x00010001;
+	return (value | (overflow * 0xFF)) & kLowChannels;
+}
+
 void doBlitOpaqueFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep);
 void doBlitBinaryFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep);
 void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color);
@@ -86,17 +117,24 @@ TransparentSurface::TransparentSurface(const Surface &surf, bool copyData) : Sur
  */
 void doBlitOpaqueFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep) {
 
-	byte *in;
-	byte *out;
-
 	for (uint32 i = 0; i < height; i++) {
-		out = outo;
-		in = ino;
-		memcpy(out, in, width * 4);
-		for (uint32 j = 0; j < width; j++) {
-			out[kAIndex] = 0xFF;
-			out += 4;
+		const byte *in = ino;
+		uint32 *out = (uint32 *)outo;
+
+		// Horizontally flipped blits walk the source backwards, thus we
+		// cannot simply copy the whole line.
+		if (inStep == 4) {
+			memcpy(out, in, width * 4);
+			for (uint32 j = 0; j < width; j++) {
+				out[j] |= kAlphaMask;
+			}
+		} else {
+			for (uint32 j = 0; j < width; j++) {
+				out[j] = *(const uint32 *)in | kAlphaMask;
+				in += inStep;
+			}
 		}
+
 		outo += pitch;
 		ino += inoStep;
 	}
@@ -107,21 +145,16 @@ void doBlitOpaqueFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32
  */
 void doBlitBinaryFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep) {
 
-	byte *in;
-	byte *out;
-
 	for (uint32 i = 0; i < height; i++) {
-		out = outo;
-		in = ino;
+		const byte *in = ino;
+		uint32 *out = (uint32 *)outo;
+
 		for (uint32 j = 0; j < width; j++) {
-			uint32 pix = *(uint32 *)in;
-			int a = in[kAIndex];
+			const uint32 pix = *(const uint32 *)in;
 
-			if (a != 0) {   // Full opacity (Any value not exactly 0 is Opaque here)
-				*(uint32 *)out = pix;
-				out[kAIndex] = 0xFF;
+			if (pix & kAlphaMask) {   // Full opacity (Any value not exactly 0 is Opaque here)
+				out[j] = pix | kAlphaMask;
 			}
-			out += 4;
 			in += inStep;
 		}
 		outo += pitch;
@@ -144,32 +177,67 @@ void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 	byte *in;
 	byte *out;
 
+	byte ca = (color >> kAModShift) & 0xFF;
+	byte cr = (color >> kRModShift) & 0xFF;
+	byte cg = (color >> kGModShift) & 0xFF;
+	byte cb = (color >> kBModShift) & 0xFF;
+
 	if (color == 0xffffffff) {
 
 		for (uint32 i = 0; i < height; i++) {
-			out = outo;
-			in = ino;
+			const byte *inPix = ino;
+			uint32 *outPix = (uint32 *)outo;
 			for (uint32 j = 0; j < width; j++) {
+				const uint32 pix = *(const uint32 *)inPix;
+				const uint32 a = pix & kAlphaMask;
 
-				if (in[kAIndex] != 0) {
-					out[kAIndex] = 255;
-					out[kRIndex] = ((in[kRIndex] * in[kAIndex]) + out[kRIndex] * (255 - in[kAIndex])) >> 8;
-					out[kGIndex] = ((in[kGIndex] * in[kAIndex]) + out[kGIndex] * (255 - in[kAIndex])) >> 8;
-					out[kBIndex] = ((in[kBIndex] * in[kAIndex]) + out[kBIndex] * (255 - in[kAIndex])) >> 8;
+				if (a != 0) {
+					outPix[j] = blendPixel(pix, outPix[j], a);
 				}
 
-				in += inStep;
-				out += 4;
+				inPix += inStep;
 			}
 			outo += pitch;
 			ino += inoStep;
 		}
-	} else {
+	} else if (cr == cg && cg == cb) {
+		// Uniform color modulation, like fades or plain alpha modulation.
+		// The products of a channel with the alpha and modulation values need
+		// up to 24 bits, thus this uses 64 bit arithmetic with two 32 bit
+		// lanes. The results match the per channel code below.
+		const uint64 kLanes = 0x000000FF000000FFULL;
 
-		byte ca = (color >> kAModShift) & 0xFF;
-		byte cr = (color >> kRModShift) & 0xFF;
-		byte cg = (color >> kGModShift) & 0xFF;
-		byte cb = (color >> kBModShift) & 0xFF;
+		for (uint32 i = 0; i < height; i++) {
+			const byte *inPix = ino;
+			uint32 *outPix = (uint32 *)outo;
+			for (uint32 j = 0; j < width; j++) {
+				const uint32 pix = *(const uint32 *)inPix;
+				const uint32 ina = (pix & kAlphaMask) * ca >> 8;
+
+				if (ina != 0) {
+					const uint32 dst = outPix[j];
+					const uint32 invAlpha = 255 - ina;
+					const uint32 factor = ina * cb;
+
+					// Attenuate the destination, all channels at once.
+					const uint32 dstBR = ((((dst >> 8) & kLowChannels) * invAlpha) >> 8) & kLowChannels;
+					const uint32 dstG = (((dst & kLowChannels) * invAlpha) >> 8) & kGreenMask;
+
+					// Add the modulated source, two channels at once.
+					const uint64 srcBR = (((uint64)(pix >> 8) & 0xFF) | ((uint64)(pix >> 24) << 32)) * factor;
+					const uint64 srcG = (uint64)((pix >> 16) & 0xFF) * factor;
+					const uint64 sumBR = (srcBR >> 16) & kLanes;
+
+					outPix[j] = ((dstBR + (uint32)(sumBR | (sumBR >> 16))) << 8)
+					          + dstG + ((uint32)(srcG >> 16) << 16) + kAlphaMask;
+				}
+
+				inPix += inStep;
+			}
+			outo += pitch;
+			ino += inoStep;
+		}
+	} else {
 
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
@@ -208,18 +276,20 @@ void doBlitAdditiveBlend(byte *ino, byte *outo, uint32 width, uint32 height, uin
 	if (color == 0xffffffff) {
 
 		for (uint32 i = 0; i < height; i++) {
-			out = outo;
-			in = ino;
+			const byte *inPix = ino;
+			uint32 *outPix = (uint32 *)outo;
 			for (uint32 j = 0; j < width; j++) {
-
-				if (in[kAIndex] != 0) {
-					out[kRIndex] = MIN((in[kRIndex] * in[kAIndex] >> 8) + out[kRIndex], 255);
-					out[kGIndex] = MIN((in[kGIndex] * in[kAIndex] >> 8) + out[kGIndex], 255);
-					out[kBIndex] = MIN((in[kBIndex] * in[kAIndex] >> 8) + out[kBIndex], 255);
+				const uint32 pix = *(const uint32 *)inPix;
+				const uint32 a = pix & kAlphaMask;
+
+				if (a != 0) {
+					const uint32 dst = outPix[j];
+					const uint32 br = saturateLanes(((((pix >> 8) & kLowChannels) * a >> 8) & kLowChannels) + ((dst >> 8) & kLowChannels));
+					const uint32 g = saturateLanes((((pix & kGreenMask) >> 16) * a >> 8) + ((dst & kGreenMask) >> 16));
+					outPix[j] = (br << 8) | (g << 16) | (dst & kAlphaMask);
 				}
 
-				in += inStep;
-				out += 4;
+				inPix += inStep;
 			}
 			outo += pitch;
 			ino += inoStep;
@@ -1154,9 +1224,20 @@ TransparentSurface *TransparentSurface::convertTo(const PixelFormat &dstFormat,
 
 template <typename Size>
 void TransparentSurface::scaleNN(int *scaleCacheX, TransparentSurface *target) const {
+	int lastSrcY = -1;
 	for (int y = 0; y < target->h; y++) {
 		Size *destP = (Size *)target->getBasePtr(0, y);
-		const Size *srcP = (const Size *)getBasePtr(0, (y * h) / target->h);
+		const int srcY = (y * h) / target->h;
+
+		// When scaling up several destination lines use the same source
+		// line. Those are simply copies of the line we scaled before.
+		if (srcY == lastSrcY) {
+			memcpy(destP, target->getBasePtr(0, y - 1), target->w * sizeof(Size));
+			continue;
+		}
+		lastSrcY = srcY;
+
+		const Size *srcP = (const Size *)getBasePtr(0, srcY);
 		for (int x = 0; x < target->w; x++) {
 			*destP++ = srcP[scaleCacheX[x]];
 		}
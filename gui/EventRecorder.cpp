@@ -59,6 +59,17 @@ uint32 readTime(Common::ReadStream *inFile) {
 	return d;
 }
 
+/** Wall clock time in microseconds, unaffected by playback. */
+static uint64 getRealMicros() {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	uint64 counter = SDL_GetPerformanceCounter();
+	uint64 frequency = SDL_GetPerformanceFrequency();
+	return (counter / frequency) * 1000000 + (counter % frequency) * 1000000 / frequency;
+#else
+	return (uint64)SDL_GetTicks() * 1000;
+#endif
+}
+
 void writeTime(Common::WriteStream *outFile, uint32 d) {
 		//Simple RLE compression
 	if (d >= 0xff) {
@@ -77,6 +88,15 @@ EventRecorder::EventRecorder() {
 	_needRedraw = false;
 	_fastPlayback = false;
 
+	_benchmark = false;
+	_benchmarkFinished = false;
+	_benchmarkFrames = 0;
+	_benchmarkStart = 0;
+	_benchmarkFrameStart = 0;
+	_benchmarkRenderStart = 0;
+	_benchmarkRenderTime = 0;
+	_benchmarkMaxFrame = 0;
+
 	_fakeTimer = 0;
 	_savedState = false;
 	_needcontinueGame = false;
@@ -106,6 +126,9 @@ void EventRecorder::deinit() {
 	_needRedraw = false;
 	_initialized = false;
 	_recordMode = kPassthrough;
+	_benchmark = false;
+	_benchmarkFinished = false;
+	_fastPlayback = false;
 	delete _fakeMixerManager;
 	_fakeMixerManager = NULL;
 	_controlPanel->close();
@@ -128,8 +151,10 @@ void EventRecorder::processMillis(uint32 &millis, bool skipRecord) {
 		millis = _fakeTimer;
 		return;
 	}
-	if (_recordMode == kRecorderPlaybackPause) {
+	if (_recordMode == kRecorderPlaybackPause || _benchmarkFinished) {
 		millis = _fakeTimer;
+		if (_benchmarkFinished)
+			return;
 	}
 	uint32 millisDelay;
 	Common::RecorderEvent timerEvent;
@@ -152,6 +177,8 @@ void EventRecorder::processMillis(uint32 &millis, bool skipRecord) {
 			_fakeTimer = _nextEvent.time;
 			_nextEvent = _playbackFile->getNextEvent();
 			_timerManager->handler();
+		} else if (_benchmark && (_nextEvent.type == Common::EVENT_RTL || _nextEvent.type == Common::EVENT_INVALID)) {
+			finishBenchmark();
 		} else {
 			if (_nextEvent.type == Common::EVENT_RTL) {
 				error("playback:action=stopplayback");
@@ -261,7 +288,7 @@ Common::String EventRecorder::generateRecordFileName(const Common::String &targe
 }
 
 
-void EventRecorder::init(Common::String recordFileName, RecordMode mode) {
+void EventRecorder::init(Common::String recordFileName, RecordMode mode, bool benchmark) {
 	_fakeMixerManager = new NullSdlMixerManager();
 	_fakeMixerManager->init();
 	_fakeMixerManager->suspendAudio();
@@ -271,6 +298,12 @@ void EventRecorder::init(Common::String recordFileName, RecordMode mode) {
 	_lastScreenshotTime = 0;
 	_recordMode = mode;
 	_needcontinueGame = false;
+	_benchmark = benchmark && (mode == kRecorderPlayback);
+	_benchmarkFinished = false;
+	_benchmarkFrames = 0;
+	_benchmarkRenderTime = 0;
+	_benchmarkMaxFrame = 0;
+	_fastPlayback = _benchmark;
 	if (ConfMan.hasKey("disable_display")) {
 		DebugMan.enableDebugChannel("EventRec");
 		gDebugLevel = 1;
@@ -303,6 +336,10 @@ void EventRecorder::init(Common::String recordFileName, RecordMode mode) {
 	switchTimerManagers();
 	_needRedraw = true;
 	_initialized = true;
+	if (_benchmark) {
+		_benchmarkStart = getRealMicros();
+		_benchmarkFrameStart = _benchmarkStart;
+	}
 }
 
 
@@ -445,7 +482,8 @@ Common::List<Common::Event> EventRecorder::mapEvent(const Common::Event &ev, Com
 	evt.mouse.y = evt.mouse.y * (g_system->getOverlayHeight() / g_system->getHeight());
 	switch (_recordMode) {
 	case kRecorderPlayback:
-		if (ev.kbdRepeat != true) {
+		// Let the quit event pushed at the end of a benchmark through
+		if (ev.kbdRepeat != true && !_benchmarkFinished) {
 			return Common::List<Common::Event>();
 		}
 		return Common::DefaultEventMapper::mapEvent(ev, source);
@@ -517,6 +555,39 @@ void EventRecorder::takeScreenshot() {
 	}
 }
 
+/**
+ * Print the benchmark report and quit the game. Times are wall clock
+ * microseconds; "engine" is everything outside of updateScreen().
+ */
+void EventRecorder::finishBenchmark() {
+	if (_benchmarkFinished)
+		return;
+	_benchmarkFinished = true;
+
+	uint64 total = getRealMicros() - _benchmarkStart;
+	uint64 engine = total - _benchmarkRenderTime;
+	uint32 frames = MAX<uint32>(_benchmarkFrames, 1);
+
+	Common::String screenMD5 = "none";
+	Graphics::Surface screen;
+	uint8 md5[16];
+	if (grabScreenAndComputeMD5(screen, md5)) {
+		screenMD5.clear();
+		for (int i = 0; i < 16; i++)
+			screenMD5 += Common::String::format("%02x", md5[i]);
+		screen.free();
+	}
+
+	debug("benchmark:frames=%u gametime=%u total=%u engine=%u render=%u (ms) avgframe=%u maxframe=%u avgengine=%u avgrender=%u (us) screenmd5=%s",
+		_benchmarkFrames, (uint32)_fakeTimer, (uint32)(total / 1000), (uint32)(engine / 1000), (uint32)(_benchmarkRenderTime / 1000),
+		(uint32)(total / frames), (uint32)_benchmarkMaxFrame, (uint32)(engine / frames), (uint32)(_benchmarkRenderTime / frames),
+		screenMD5.c_str());
+
+	Common::Event quitEvent;
+	quitEvent.type = Common::EVENT_QUIT;
+	g_system->getEventManager()->pushEvent(quitEvent);
+}
+
 bool EventRecorder::grabScreenAndComputeMD5(Graphics::Surface &screen, uint8 md5[16]) {
 	if (!createScreenShot(screen)) {
 		warning("Can't save screenshot");
@@ -556,6 +627,11 @@ Common::SaveFileManager *EventRecorder::getSaveManager(Common::SaveFileManager *
 }
 
 void EventRecorder::preDrawOverlayGui() {
+	if (_benchmark) {
+		// No control panel in benchmark mode, only time the screen update
+		_benchmarkRenderStart = getRealMicros();
+		return;
+	}
 	if ((_initialized) || (_needRedraw)) {
 		RecordMode oldMode = _recordMode;
 		_recordMode = kPassthrough;
@@ -572,6 +648,16 @@ void EventRecorder::preDrawOverlayGui() {
 }
 
 void EventRecorder::postDrawOverlayGui() {
+	if (_benchmark) {
+		if (_initialized && !_benchmarkFinished) {
+			uint64 now = getRealMicros();
+			_benchmarkRenderTime += now - _benchmarkRenderStart;
+			_benchmarkMaxFrame = MAX(_benchmarkMaxFrame, now - _benchmarkFrameStart);
+			_benchmarkFrameStart = now;
+			_benchmarkFrames++;
+		}
+		return;
+	}
     if ((_initialized) || (_needRedraw)) {
 		RecordMode oldMode = _recordMode;
 		_recordMode = kPassthrough;
@@ -78,7 +78,12 @@ public:
 		kRecorderPlaybackPause = 3	/**< kRecordetPlaybackPause, interal state when user pauses the playback */
 	};
 
-	void init(Common::String recordFileName, RecordMode mode);
+	/**
+	 * Start recording or playing back. With benchmark set, playback runs
+	 * as fast as possible without the control panel, and a timing report
+	 * is printed once the recording runs out.
+	 */
+	void init(Common::String recordFileName, RecordMode mode, bool benchmark = false);
 	void deinit();
 	bool processDelayMillis();
 	uint32 getRandomSeed(const Common::String &name);
@@ -214,6 +219,8 @@ private:
 
 	bool checkGameHash(const ADGameDescription *desc);
 
+	void finishBenchmark();
+
 	void checkForKeyCode(const Common::Event &event);
 	bool allowMapping() const { return false; }
 
@@ -229,6 +236,15 @@ private:
 	Common::String _recordFileName;
 	bool _fastPlayback;
 	bool _needRedraw;
+
+	bool _benchmark;
+	bool _benchmarkFinished;
+	uint32 _benchmarkFrames;
+	uint64 _benchmarkStart;
+	uint64 _benchmarkFrameStart;
+	uint64 _benchmarkRenderStart;
+	uint64 _benchmarkRenderTime;
+	uint64 _benchmarkMaxFrame;
 };
 
 } // End of namespace GUI
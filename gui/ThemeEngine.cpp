@@ -168,7 +168,7 @@ static const DrawDataInfo kDrawDataDefaults[] = {
 ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_system(0), _vectorRenderer(0),
 	_layerToDraw(kDrawLayerBackground), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
-	_font(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
+	_font(0), _drawDataCacheBytes(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
 	_cursor(0) {
 
 	_system = g_system;
@@ -218,6 +218,7 @@ ThemeEngine::~ThemeEngine() {
 	_backBuffer.free();
 
 	unloadTheme();
+	clearDrawDataCache();
 
 	// Release all graphics surfaces
 	for (ImagesMap::iterator i = _bitmaps.begin(); i != _bitmaps.end(); ++i) {
@@ -439,6 +440,9 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 	_vectorRenderer = Graphics::createRenderer(mode);
 	_vectorRenderer->setSurface(&_screen);
 
+	// Cached items were rendered with the previous renderer and format.
+	clearDrawDataCache();
+
 	// Since we reinitialized our screen surfaces we know nothing has been
 	// drawn so far. Sometimes we still end up with dirty screen bits in the
 	// list. Clearing it avoids invalid overlay writes when the backend
@@ -727,6 +731,8 @@ void ThemeEngine::unloadTheme() {
 	if (!_themeOk)
 		return;
 
+	clearDrawDataCache();
+
 	for (int i = 0; i < kDrawDataMAX; ++i) {
 		delete _widgets[i];
 		_widgets[i] = 0;
@@ -865,7 +871,14 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 		extendedRect.bottom += drawData->_shadowOffset - drawData->_backgroundOffset;
 	}
 
+	// Only items drawn without any clipping can be cached, the result of
+	// clipped ones depends on where they are placed.
+	bool cacheable = area == r && Common::Rect(_screen.w, _screen.h).contains(extendedRect) &&
+	                 (uint32)(extendedRect.width() * extendedRect.height() * _bytesPerPixel * 2) <= kDrawDataCacheSize / 8;
+
 	if (!_clip.isEmpty()) {
+		if (!_clip.contains(extendedRect))
+			cacheable = false;
 		extendedRect.clip(_clip);
 	}
 
@@ -873,15 +886,100 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 		restoreBackground(extendedRect);
 
 	if (drawData->_layer == _layerToDraw) {
+		if (cacheable && drawCachedDD(type, area, extendedRect, dynamic)) {
+			addDirtyRect(extendedRect);
+			return;
+		}
+
+		Graphics::Surface before;
+		if (cacheable)
+			before.copyFrom(_vectorRenderer->getActiveSurface()->getSubArea(extendedRect));
+
 		Common::List<Graphics::DrawStep>::const_iterator step;
 		for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
 			_vectorRenderer->drawStepClip(area, _clip, *step, dynamic);
 		}
 
+		if (cacheable)
+			cacheDD(type, area, extendedRect, dynamic, before);
+
 		addDirtyRect(extendedRect);
 	}
 }
 
+bool ThemeEngine::drawCachedDD(DrawData type, const Common::Rect &area, const Common::Rect &extendedRect, uint32 dynamic) {
+	Graphics::Surface *surface = _vectorRenderer->getActiveSurface();
+	const byte parity = (area.left & 1) | ((area.top & 1) << 1);
+	const uint rowBytes = extendedRect.width() * surface->format.bytesPerPixel;
+
+	for (DrawDataCache::iterator i = _drawDataCache.begin(); i != _drawDataCache.end(); ++i) {
+		if (i->type != type || i->width != area.width() || i->height != area.height() ||
+		    i->dynamic != dynamic || i->parity != parity ||
+		    i->before.w != extendedRect.width() || i->before.h != extendedRect.height())
+			continue;
+
+		byte *dst = (byte *)surface->getBasePtr(extendedRect.left, extendedRect.top);
+
+		int y;
+		for (y = 0; y < extendedRect.height(); ++y) {
+			if (memcmp(dst + y * surface->pitch, i->before.getBasePtr(0, y), rowBytes))
+				break;
+		}
+
+		if (y != extendedRect.height())
+			continue;
+
+		for (y = 0; y < extendedRect.height(); ++y) {
+			memcpy(dst, i->after.getBasePtr(0, y), rowBytes);
+			dst += surface->pitch;
+		}
+
+		// Keep the most recently used items in front, eviction starts at the back.
+		if (i != _drawDataCache.begin()) {
+			DrawDataCacheEntry entry = *i;
+			_drawDataCache.erase(i);
+			_drawDataCache.push_front(entry);
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+void ThemeEngine::cacheDD(DrawData type, const Common::Rect &area, const Common::Rect &extendedRect, uint32 dynamic,
+                          const Graphics::Surface &before) {
+	DrawDataCacheEntry entry;
+	entry.type = type;
+	entry.width = area.width();
+	entry.height = area.height();
+	entry.dynamic = dynamic;
+	entry.parity = (area.left & 1) | ((area.top & 1) << 1);
+	entry.before = before;
+	entry.after.copyFrom(_vectorRenderer->getActiveSurface()->getSubArea(extendedRect));
+
+	_drawDataCache.push_front(entry);
+	_drawDataCacheBytes += before.pitch * before.h + entry.after.pitch * entry.after.h;
+
+	while (_drawDataCacheBytes > kDrawDataCacheSize) {
+		DrawDataCacheEntry &last = _drawDataCache.back();
+		_drawDataCacheBytes -= last.before.pitch * last.before.h + last.after.pitch * last.after.h;
+		last.before.free();
+		last.after.free();
+		_drawDataCache.pop_back();
+	}
+}
+
+void ThemeEngine::clearDrawDataCache() {
+	for (DrawDataCache::iterator i = _drawDataCache.begin(); i != _drawDataCache.end(); ++i) {
+		i->before.free();
+		i->after.free();
+	}
+
+	_drawDataCache.clear();
+	_drawDataCacheBytes = 0;
+}
+
 void ThemeEngine::drawDDText(TextData type, TextColor color, const Common::Rect &r, const Common::String &text,
                              bool restoreBg, bool ellipsis, Graphics::TextAlign alignH, TextAlignVertical alignV,
                              int deltax, const Common::Rect &drawableTextArea) {
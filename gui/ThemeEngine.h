@@ -635,6 +635,45 @@ protected:
 	                const Common::Rect &drawableTextArea = Common::Rect(0, 0, 0, 0));
 	void drawBitmap(const Graphics::Surface *bitmap, const Common::Rect &clippingRect, bool alpha);
 
+	/**
+	 * Rendered DrawData cache.
+	 *
+	 * Drawing a DrawData item only depends on its steps, its size, the
+	 * dynamic parameter and the pixels it is drawn over. Each entry keeps
+	 * the area it covers before and after drawing, so a later draw of the
+	 * same item over the same pixels becomes a plain copy.
+	 */
+	struct DrawDataCacheEntry {
+		DrawData type;
+		int16 width, height;
+		uint32 dynamic;
+		byte parity;                ///< Odd x/y position flags, for dithered gradients
+		Graphics::Surface before;   ///< Extended area before drawing
+		Graphics::Surface after;    ///< Extended area after drawing
+	};
+
+	typedef Common::List<DrawDataCacheEntry> DrawDataCache;
+
+	/** Maximal amount of bytes held by the DrawData cache. */
+	static const uint32 kDrawDataCacheSize = 4 * 1024 * 1024;
+
+	/**
+	 * Tries to draw a DrawData item from the cache.
+	 *
+	 * @return true if the item has been copied to the active surface.
+	 */
+	bool drawCachedDD(DrawData type, const Common::Rect &area, const Common::Rect &extendedRect, uint32 dynamic);
+
+	/**
+	 * Adds a freshly drawn DrawData item to the cache. The cache takes
+	 * over the pixels of before.
+	 */
+	void cacheDD(DrawData type, const Common::Rect &area, const Common::Rect &extendedRect, uint32 dynamic,
+	             const Graphics::Surface &before);
+
+	/** Frees all rendered DrawData items. */
+	void clearDrawDataCache();
+
 	/**
 	 * DEBUG: Draws a white square and writes some text next to it.
 	 */
@@ -718,6 +757,10 @@ protected:
 	/** List of all the dirty screens that must be blitted to the overlay. */
 	Common::List<Common::Rect> _dirtyScreen;
 
+	/** Rendered DrawData items, most recently used first. */
+	DrawDataCache _drawDataCache;
+	uint32 _drawDataCacheBytes;
+
 	bool _initOk;  ///< Class and renderer properly initialized
 	bool _themeOk; ///< Theme data successfully loaded.
 	bool _enabled; ///< Whether the Theme is currently shown on the overlay